@@ -0,0 +1,113 @@
+/*Shared driver for the array programs that work on very large inputs (code153.c - code156.c). The array is either typed in or a binary file of 32-bit integers mapped into memory with mmap, so no program copies the file through a buffer. forEachChunk cuts an index range into CHUNK-element chunks and hands them to one thread per core (link with -pthread); every chunk gets its index, so results can be stored per chunk and merged in order.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#define CHUNK (1 << 18)    /* elements per chunk: 1 MB, so a second loop over it hits the L2 cache */
+
+/* Called for elements [offset, offset + len) of the range; chunk is offset / CHUNK. */
+typedef void (*ChunkFunction)(long long chunk, long long offset, long long len, void *ctx);
+
+typedef struct {
+    long long n, chunks;
+    long long next;     /* next chunk to hand out */
+    ChunkFunction f;
+    void *ctx;
+} ChunkWork;
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+long long chunkCount(long long n) {
+    return (n + CHUNK - 1) / CHUNK;
+}
+
+void *chunkWorker(void *arg) {
+    ChunkWork *w = (ChunkWork *)arg;
+    for (;;) {
+        long long c = __sync_fetch_and_add(&w->next, 1);
+        if (c >= w->chunks) {
+            return NULL;
+        }
+        long long offset = c * CHUNK;
+        w->f(c, offset, w->n - offset < CHUNK ? w->n - offset : CHUNK, w->ctx);
+    }
+}
+
+/* Runs f over every chunk of [0, n) on up to threads threads; the calling thread takes chunks
+   too. Chunks are handed out in increasing order, so a function that stops early (a search)
+   can skip chunks past the one where it already succeeded. */
+void forEachChunk(long long n, int threads, ChunkFunction f, void *ctx) {
+    ChunkWork work = {n, chunkCount(n), 0, f, ctx};
+    threads = threads < work.chunks ? threads : (int)work.chunks;
+    threads = threads < 1 ? 1 : threads;
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, chunkWorker, &work);
+    }
+    chunkWorker(&work);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(ids);
+}
+
+/* Mode 1 reads the array from standard input with the program's own prompts; mode 2 asks for
+   a file name and maps the file, read-only or (writable) shared so changes go to the file.
+   Returns NULL after printing the error. An empty input gives a valid pointer with n = 0. */
+int *loadArray(int mode, int writable, const char *sizePrompt, const char *elementsPrompt, long long *n) {
+    static int empty;
+    if (mode != 2) {
+        int count;
+        printf("%s", sizePrompt);
+        scanf("%d", &count);
+        *n = count > 0 ? count : 0;
+        int *arr = (int *)malloc((*n + 1) * sizeof(int));
+        printf("%s", elementsPrompt);
+        for (long long i = 0; i < *n; i++) {
+            scanf("%d", &arr[i]);
+        }
+        return arr;
+    }
+    char fileName[256];
+    printf("Enter the file name: ");
+    scanf("%255s", fileName);
+    int fd = open(fileName, writable ? O_RDWR : O_RDONLY);
+    struct stat info;
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        printf("Error opening file.\n");
+        if (fd >= 0) {
+            close(fd);
+        }
+        return NULL;
+    }
+    *n = (long long)info.st_size / (long long)sizeof(int);
+    if (*n == 0) {
+        close(fd);
+        return &empty;
+    }
+    void *data = mmap(NULL, (size_t)*n * sizeof(int), writable ? PROT_READ | PROT_WRITE : PROT_READ,
+                      MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        printf("Error mapping file.\n");
+        return NULL;
+    }
+    /* Every chunk is read front to back once. */
+    madvise(data, (size_t)*n * sizeof(int), MADV_SEQUENTIAL);
+    return (int *)data;
+}
+
+void releaseArray(int mode, int *arr, long long n) {
+    if (mode != 2) {
+        free(arr);
+    } else if (n > 0) {
+        munmap(arr, (size_t)n * sizeof(int));
+    }
+}
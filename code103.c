@@ -1,30 +1,122 @@
 //Write a Program to take an array of integers as input, calculate the pivot index of this array. The pivot index is the index where the sum of all the numbers strictly to the left of the index is equal to the sum of all the numbers strictly to the index's right. If the index is on the left edge of the array, then the left sum is 0 because there are no elements to the left. This also applies to the right edge of the array. Print the leftmost pivot index. If no such index exists, print -1.
 #include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define BLOCK (1 << 16)          /* elements per block of the parallel scan */
+#define PARALLEL_MIN (1 << 22)   /* below this the single pass is faster than starting threads */
+
+/* i is a pivot when leftSum(i) * 2 + arr[i] == total. The parallel version is a two-pass
+   prefix sum (link with -pthread): threads first sum every block, the block offsets are
+   scanned serially, and then every block is searched from its own offset. Blocks are handed
+   out in order, so once a pivot is found no later block needs to be searched. */
+typedef struct {
+    const int *arr;
+    int n, blocks;
+    long long total;
+    long long *offsets;
+    int phase;
+    int next;
+    int found;      /* leftmost pivot so far, n if none */
+} PivotWork;
+
+void *pivotWorker(void *arg) {
+    PivotWork *w = (PivotWork *)arg;
+    for (;;) {
+        int b = __sync_fetch_and_add(&w->next, 1);
+        if (b >= w->blocks) {
+            return NULL;
+        }
+        int first = b * BLOCK, last = first + BLOCK < w->n ? first + BLOCK : w->n;
+        if (w->phase == 1) {
+            long long s = 0;
+            for (int i = first; i < last; i++) {
+                s += w->arr[i];
+            }
+            w->offsets[b] = s;
+            continue;
+        }
+        if (first >= __atomic_load_n(&w->found, __ATOMIC_RELAXED)) {
+            continue;
+        }
+        long long leftSum = w->offsets[b];
+        for (int i = first; i < last; i++) {
+            if (leftSum * 2 + w->arr[i] == w->total) {
+                int seen = __atomic_load_n(&w->found, __ATOMIC_RELAXED);
+                while (i < seen && !__atomic_compare_exchange_n(&w->found, &seen, i, 0,
+                                                                 __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                }
+                break;
+            }
+            leftSum += w->arr[i];
+        }
+    }
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+void runPhase(PivotWork *w, int phase, int threads) {
+    pthread_t ids[64];
+    w->phase = phase;
+    w->next = 0;
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, pivotWorker, w);
+    }
+    pivotWorker(w);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+}
+
+int pivotIndex(const int *arr, int n, int threads) {
+    if (n < PARALLEL_MIN || threads < 2) {
+        long long totalSum = 0;
+        for (int i = 0; i < n; i++) {
+            totalSum += arr[i];
+        }
+
+        long long leftSum = 0;
+        for (int i = 0; i < n; i++) {
+            totalSum =totalSum-arr[i]; 
+            if (leftSum == totalSum) {
+                return i;
+            }
+            leftSum =leftSum+ arr[i];
+        }
+        return -1;
+    }
+    int blocks = (n + BLOCK - 1) / BLOCK;
+    PivotWork work = {arr, n, blocks, 0, (long long *)malloc(blocks * sizeof(long long)), 0, 0, n};
+    threads = threads < blocks ? threads : blocks;
+
+    runPhase(&work, 1, threads);
+    long long running = 0;
+    for (int b = 0; b < blocks; b++) {
+        long long s = work.offsets[b];
+        work.offsets[b] = running;
+        running += s;
+    }
+    work.total = running;
+    runPhase(&work, 2, threads);
+    free(work.offsets);
+    return work.found < n ? work.found : -1;
+}
+
 int main() {
-    int arr[100], n;
+    int n;
     printf("Enter number of elements in the array: ");
     scanf("%d", &n);
+    int *arr = (int *)malloc((n > 0 ? n : 1) * sizeof(int));
     printf("Enter elements of the array: ");
     for (int i = 0; i < n; i++) {
         scanf("%d", &arr[i]);
     }
 
-    int totalSum = 0;
-    for (int i = 0; i < n; i++) {
-        totalSum += arr[i];
-    }
-
-    int leftSum = 0;
-    int pivotIndex = -1;
-    for (int i = 0; i < n; i++) {
-        totalSum =totalSum-arr[i]; 
-        if (leftSum == totalSum) {
-            pivotIndex = i;
-            break;
-        }
-        leftSum =leftSum+ arr[i];
-    }
-
-    printf("Pivot index: %d\n", pivotIndex);
+    printf("Pivot index: %d\n", pivotIndex(arr, n, coreCount()));
+    free(arr);
     return 0;
-}
\ No newline at end of file
+}
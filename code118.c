@@ -2,7 +2,8 @@
 */
 #include <stdio.h>
 int main() {
-    int n, i, sum = 0, total_sum;
+    int n, i;
+    long long sum = 0, total_sum;
     printf("Enter the size of the array (n): ");
     scanf("%d", &n);
     int arr[n - 1];
@@ -11,7 +12,7 @@ int main() {
         scanf("%d", &arr[i]);
         sum += arr[i];
     }
-    total_sum=n*(n+1)/2;
-    printf("The missing number is: %d\n", total_sum - sum);
+    total_sum=(long long)n*(n+1)/2;
+    printf("The missing number is: %lld\n", total_sum - sum);
     return 0;
 }
\ No newline at end of file
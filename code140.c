@@ -0,0 +1,221 @@
+/*Write a program to take an integer array nums, an integer k (2, 3 or 4) and an integer target as inputs. Print every unique group of k elements whose sum equals the target, one group per line in ascending order. Print "-1" if no such group exists. Sort the array once (radix sort) and use two pointers for the innermost pair so that 3-sum runs in O(n^2). The outermost loop is split across one thread per core (link with -pthread).*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* LSD radix sort on 8-bit digits; the sign bit is flipped so negatives sort first. */
+void radixSort(int *arr, int n) {
+    unsigned int *keys = (unsigned int *)malloc(n * sizeof(unsigned int));
+    unsigned int *temp = (unsigned int *)malloc(n * sizeof(unsigned int));
+    for (int i = 0; i < n; i++) {
+        keys[i] = (unsigned int)arr[i] ^ 0x80000000u;
+    }
+    for (int shift = 0; shift < 32; shift += 8) {
+        int count[257] = {0};
+        for (int i = 0; i < n; i++) {
+            count[((keys[i] >> shift) & 0xFF) + 1]++;
+        }
+        for (int d = 0; d < 256; d++) {
+            count[d + 1] += count[d];
+        }
+        for (int i = 0; i < n; i++) {
+            temp[count[(keys[i] >> shift) & 0xFF]++] = keys[i];
+        }
+        unsigned int *swap = keys;
+        keys = temp;
+        temp = swap;
+    }
+    for (int i = 0; i < n; i++) {
+        arr[i] = (int)(keys[i] ^ 0x80000000u);
+    }
+    free(keys);
+    free(temp);
+}
+
+/* Groups found by one piece of work, k values per group, kept in the order found. */
+typedef struct {
+    int *values;
+    long long count;
+    long long capacity;
+} GroupBuffer;
+
+void addGroup(GroupBuffer *out, int *chosen, int depth, int a, int b) {
+    if ((out->count + 1) * (depth + 2) > out->capacity) {
+        out->capacity = out->capacity * 2 + 64;
+        out->values = (int *)realloc(out->values, out->capacity * sizeof(int));
+    }
+    int *group = out->values + out->count * (depth + 2);
+    for (int i = 0; i < depth; i++) {
+        group[i] = chosen[i];
+    }
+    group[depth] = a;
+    group[depth + 1] = b;
+    out->count++;
+}
+
+void printGroups(const GroupBuffer *out, int k) {
+    for (long long g = 0; g < out->count; g++) {
+        for (int i = 0; i < k; i++) {
+            printf(i + 1 < k ? "%d " : "%d\n", out->values[g * k + i]);
+        }
+    }
+}
+
+long long kSum(int *nums, int n, int start, int k, long long target, int *chosen, int depth, GroupBuffer *out);
+
+/* One iteration of the outer loop of kSum: fixes nums[i] and searches the rest.
+   Returns -1 when no later i can reach the target either. */
+long long outerStep(int *nums, int n, int start, int i, int k, long long target, int *chosen, int depth,
+                    GroupBuffer *out) {
+    if (i > start && nums[i] == nums[i - 1]) {
+        return 0;
+    }
+    /* The array is sorted, so the smallest and largest reachable sums bound the search. */
+    long long smallest = 0, largest = 0;
+    for (int j = 0; j < k; j++) {
+        smallest += nums[i + j];
+        largest += nums[n - 1 - j];
+    }
+    if (smallest > target) {
+        return -1;
+    }
+    if ((long long)nums[i] + largest - nums[n - k] < target) {
+        return 0;
+    }
+    chosen[depth] = nums[i];
+    return kSum(nums, n, i + 1, k - 1, target - nums[i], chosen, depth + 1, out);
+}
+
+/* Finds all unique k-element groups in nums[start..n-1] summing to target. */
+long long kSum(int *nums, int n, int start, int k, long long target, int *chosen, int depth, GroupBuffer *out) {
+    long long found = 0;
+    if (k == 2) {
+        int left = start, right = n - 1;
+        while (left < right) {
+            long long sum = (long long)nums[left] + nums[right];
+            if (sum < target) {
+                left++;
+            } else if (sum > target) {
+                right--;
+            } else {
+                addGroup(out, chosen, depth, nums[left], nums[right]);
+                found++;
+                left++;
+                right--;
+                while (left < right && nums[left] == nums[left - 1]) {
+                    left++;
+                }
+                while (left < right && nums[right] == nums[right + 1]) {
+                    right--;
+                }
+            }
+        }
+        return found;
+    }
+    for (int i = start; i <= n - k; i++) {
+        long long step = outerStep(nums, n, start, i, k, target, chosen, depth, out);
+        if (step < 0) {
+            break;
+        }
+        found += step;
+    }
+    return found;
+}
+
+/* The outermost loop runs on several threads. Its indices are cut into CHUNK-sized pieces
+   handed out through a shared counter (early indices have longer inner searches, so static
+   halves would be unbalanced). Every piece has its own buffer, and the buffers are printed
+   in index order afterwards, so the output is the same as with one thread. */
+#define CHUNK 64
+
+typedef struct {
+    int *nums;
+    int n, k;
+    long long target;
+    int chunks;
+    int *nextChunk;
+    GroupBuffer *buffers;
+} SharedWork;
+
+void *worker(void *arg) {
+    SharedWork *work = (SharedWork *)arg;
+    int chosen[4];
+    for (;;) {
+        int c = __sync_fetch_and_add(work->nextChunk, 1);
+        if (c >= work->chunks) {
+            return NULL;
+        }
+        int last = (c + 1) * CHUNK < work->n - work->k + 1 ? (c + 1) * CHUNK : work->n - work->k + 1;
+        for (int i = c * CHUNK; i < last; i++) {
+            if (outerStep(work->nums, work->n, 0, i, work->k, work->target, chosen, 0, &work->buffers[c]) < 0) {
+                break;
+            }
+        }
+    }
+}
+
+long long kSumParallel(int *nums, int n, int k, long long target, int threads) {
+    int outer = n - k + 1;
+    SharedWork work = {nums, n, k, target, (outer + CHUNK - 1) / CHUNK, NULL, NULL};
+    int nextChunk = 0;
+    work.nextChunk = &nextChunk;
+    work.buffers = (GroupBuffer *)calloc(work.chunks + 1, sizeof(GroupBuffer));
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        pthread_create(&ids[t], NULL, worker, &work);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    long long found = 0;
+    for (int c = 0; c < work.chunks; c++) {
+        printGroups(&work.buffers[c], k);
+        found += work.buffers[c].count;
+        free(work.buffers[c].values);
+    }
+    free(work.buffers);
+    free(ids);
+    return found;
+}
+
+int main() {
+    int n, k;
+    long long target;
+    printf("Enter the number of elements in the array: ");
+    scanf("%d", &n);
+    int *nums = (int *)malloc(n * sizeof(int));
+    printf("Enter the elements of the array:\n");
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &nums[i]);
+    }
+    printf("Enter k (2, 3 or 4): ");
+    scanf("%d", &k);
+    printf("Enter the target: ");
+    scanf("%lld", &target);
+    if (k < 2 || k > 4 || k > n) {
+        printf("Invalid value of k\n");
+        free(nums);
+        return 1;
+    }
+
+    radixSort(nums, n);
+    long long found;
+    if (k == 2) {
+        /* A single two-pointer pass: nothing to split. */
+        int chosen[4];
+        GroupBuffer out = {NULL, 0, 0};
+        found = kSum(nums, n, 0, k, target, chosen, 0, &out);
+        printGroups(&out, k);
+        free(out.values);
+    } else {
+        long threads = sysconf(_SC_NPROCESSORS_ONLN);
+        found = kSumParallel(nums, n, k, target, threads < 1 ? 1 : threads > 64 ? 64 : (int)threads);
+    }
+    if (found == 0) {
+        printf("-1\n");
+    }
+
+    free(nums);
+    return 0;
+}
@@ -0,0 +1,280 @@
+/*Write a program to sort a file of integers that is too large to fit in memory (external sort). Read the input in chunks, sort each chunk and write it to a temporary run file (created with tmpfile(), so nothing is left behind). Then merge all the sorted runs with a k-way merge that uses a loser tree (tournament tree) and large buffered reads for every run. Every run has two buffers: while the merge consumes one, a reader thread fills the other (link with -pthread), so disk reads overlap the merge. The input and the output can each be a text file or a binary file of 32-bit integers.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+typedef struct {
+    FILE *file;
+    int *buf;           /* being merged */
+    int *spare;         /* being filled by the reader thread */
+    int pos;
+    int len;
+    int capacity;       /* of each buffer */
+    int spareLen;
+    int spareReady;     /* guarded by Reader.lock */
+    int key;
+    int done;
+} Run;
+
+/* The reader thread serves refill requests in the order the merge posts them. Every run has at
+   most one request outstanding, so a ring of k entries never overflows. */
+typedef struct {
+    Run *runs;
+    int k;
+    int *queue;
+    int head, count;
+    int stop;
+    pthread_mutex_t lock;
+    pthread_cond_t wake;        /* a request was posted, or stop */
+    pthread_cond_t filled;      /* a spare buffer is ready */
+} Reader;
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+/* Reads up to max integers from fp in the given format (1 = text, 2 = binary). */
+int readChunk(FILE *fp, int format, int *buf, int max) {
+    if (format == 2) {
+        return (int)fread(buf, sizeof(int), max, fp);
+    }
+    int count = 0;
+    while (count < max && fscanf(fp, "%d", &buf[count]) == 1) {
+        count++;
+    }
+    return count;
+}
+
+/* Caller holds reader->lock. */
+void requestFill(Reader *reader, int r) {
+    reader->queue[(reader->head + reader->count) % reader->k] = r;
+    reader->count++;
+    pthread_cond_signal(&reader->wake);
+}
+
+void *readerThread(void *arg) {
+    Reader *reader = (Reader *)arg;
+    pthread_mutex_lock(&reader->lock);
+    for (;;) {
+        while (reader->count == 0 && !reader->stop) {
+            pthread_cond_wait(&reader->wake, &reader->lock);
+        }
+        if (reader->count == 0) {
+            break;
+        }
+        Run *run = &reader->runs[reader->queue[reader->head]];
+        reader->head = (reader->head + 1) % reader->k;
+        reader->count--;
+        pthread_mutex_unlock(&reader->lock);
+        /* Only this thread touches the file and, until spareReady is set, the spare buffer. */
+        int len = (int)fread(run->spare, sizeof(int), run->capacity, run->file);
+        pthread_mutex_lock(&reader->lock);
+        run->spareLen = len;
+        run->spareReady = 1;
+        pthread_cond_broadcast(&reader->filled);
+    }
+    pthread_mutex_unlock(&reader->lock);
+    return NULL;
+}
+
+/* Moves run r to its next key. When its buffer is used up it swaps in the spare one, waiting
+   only if the reader has not finished it yet, and asks for the old buffer to be refilled. */
+void advanceRun(Reader *reader, int r) {
+    Run *run = &reader->runs[r];
+    if (run->pos == run->len) {
+        pthread_mutex_lock(&reader->lock);
+        while (!run->spareReady) {
+            pthread_cond_wait(&reader->filled, &reader->lock);
+        }
+        int *used = run->buf;
+        run->buf = run->spare;
+        run->spare = used;
+        run->len = run->spareLen;
+        run->pos = 0;
+        run->spareReady = 0;
+        if (run->len > 0) {
+            requestFill(reader, r);
+        }
+        pthread_mutex_unlock(&reader->lock);
+        if (run->len == 0) {
+            run->done = 1;
+            return;
+        }
+    }
+    run->key = run->buf[run->pos++];
+}
+
+/* An exhausted run loses to everything; ties go to the lower run index to keep the merge stable. */
+int beats(Run *runs, int a, int b) {
+    if (runs[a].done) {
+        return 0;
+    }
+    if (runs[b].done) {
+        return 1;
+    }
+    if (runs[a].key != runs[b].key) {
+        return runs[a].key < runs[b].key;
+    }
+    return a < b;
+}
+
+/* tree[0] holds the overall winner, tree[1..k-1] hold the loser of each match. */
+void replay(Run *runs, int *tree, int k, int s) {
+    int t = (s + k) / 2;
+    while (t > 0) {
+        if (tree[t] == -1) {
+            tree[t] = s;
+            return;
+        }
+        if (beats(runs, tree[t], s)) {
+            int temp = tree[t];
+            tree[t] = s;
+            s = temp;
+        }
+        t /= 2;
+    }
+    tree[0] = s;
+}
+
+void writeValue(FILE *out, int format, int value) {
+    if (format == 2) {
+        fwrite(&value, sizeof(int), 1, out);
+    } else {
+        fprintf(out, "%d\n", value);
+    }
+}
+
+long long mergeRuns(Reader *reader, FILE *out, int format) {
+    Run *runs = reader->runs;
+    int k = reader->k;
+    int *tree = (int *)malloc(k * sizeof(int));
+    long long written = 0;
+    for (int i = 0; i < k; i++) {
+        tree[i] = -1;
+    }
+    for (int i = k - 1; i >= 0; i--) {
+        replay(runs, tree, k, i);
+    }
+    while (!runs[tree[0]].done) {
+        int winner = tree[0];
+        writeValue(out, format, runs[winner].key);
+        written++;
+        advanceRun(reader, winner);
+        replay(runs, tree, k, winner);
+    }
+    free(tree);
+    return written;
+}
+
+int main() {
+    char inputName[256], outputName[256];
+    int inputFormat, outputFormat, runSize;
+    printf("Enter the input file name: ");
+    scanf("%255s", inputName);
+    printf("Enter input format (1 = text, 2 = binary): ");
+    scanf("%d", &inputFormat);
+    printf("Enter the output file name: ");
+    scanf("%255s", outputName);
+    printf("Enter output format (1 = text, 2 = binary): ");
+    scanf("%d", &outputFormat);
+    printf("Enter how many integers fit in memory at once: ");
+    scanf("%d", &runSize);
+    if (runSize < 1024) {
+        runSize = 1024;
+    }
+
+    FILE *in = fopen(inputName, inputFormat == 2 ? "rb" : "r");
+    if (in == NULL) {
+        printf("Error opening input file.\n");
+        return 1;
+    }
+
+    /* Phase 1: cut the input into sorted runs. The run files come from tmpfile(), so they
+       cannot clash with existing files and are deleted on close or exit, even on errors. */
+    int *chunk = (int *)malloc(runSize * sizeof(int));
+    int runCount = 0, runCapacity = 16;
+    FILE **runFiles = (FILE **)malloc(runCapacity * sizeof(FILE *));
+    int len;
+    while ((len = readChunk(in, inputFormat, chunk, runSize)) > 0) {
+        qsort(chunk, len, sizeof(int), compareInts);
+        if (runCount == runCapacity) {
+            runCapacity *= 2;
+            runFiles = (FILE **)realloc(runFiles, runCapacity * sizeof(FILE *));
+        }
+        FILE *runFile = tmpfile();
+        if (runFile == NULL) {
+            printf("Error creating run file.\n");
+            for (int i = 0; i < runCount; i++) {
+                fclose(runFiles[i]);
+            }
+            return 1;
+        }
+        fwrite(chunk, sizeof(int), len, runFile);
+        rewind(runFile);
+        runFiles[runCount++] = runFile;
+    }
+    fclose(in);
+    free(chunk);
+    printf("Created %d sorted runs.\n", runCount);
+
+    FILE *out = fopen(outputName, outputFormat == 2 ? "wb" : "w");
+    if (out == NULL) {
+        printf("Error opening output file.\n");
+        for (int i = 0; i < runCount; i++) {
+            fclose(runFiles[i]);
+        }
+        return 1;
+    }
+    setvbuf(out, NULL, _IOFBF, 1 << 20);
+    if (runCount == 0) {
+        fclose(out);
+        free(runFiles);
+        printf("Input file is empty.\n");
+        return 0;
+    }
+
+    /* Phase 2: the memory budget is shared between the two read buffers of every run. */
+    int capacity = runSize / runCount / 2;
+    if (capacity < 1024) {
+        capacity = 1024;
+    }
+    Run *runs = (Run *)malloc(runCount * sizeof(Run));
+    Reader reader = {runs, runCount, (int *)malloc(runCount * sizeof(int)), 0, 0, 0,
+                     PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER};
+    for (int i = 0; i < runCount; i++) {
+        runs[i].file = runFiles[i];
+        runs[i].buf = (int *)malloc(capacity * sizeof(int));
+        runs[i].spare = (int *)malloc(capacity * sizeof(int));
+        runs[i].capacity = capacity;
+        runs[i].pos = 0;
+        runs[i].len = 0;
+        runs[i].spareReady = 0;
+        runs[i].done = 0;
+        requestFill(&reader, i);
+    }
+    pthread_t readerId;
+    pthread_create(&readerId, NULL, readerThread, &reader);
+    for (int i = 0; i < runCount; i++) {
+        advanceRun(&reader, i);
+    }
+
+    long long written = mergeRuns(&reader, out, outputFormat);
+    pthread_mutex_lock(&reader.lock);
+    reader.stop = 1;
+    pthread_cond_signal(&reader.wake);
+    pthread_mutex_unlock(&reader.lock);
+    pthread_join(readerId, NULL);
+    fclose(out);
+
+    for (int i = 0; i < runCount; i++) {
+        fclose(runs[i].file);
+        free(runs[i].buf);
+        free(runs[i].spare);
+    }
+    free(reader.queue);
+    free(runs);
+    free(runFiles);
+    printf("Sorted %lld integers into %s\n", written, outputName);
+    return 0;
+}
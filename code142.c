@@ -0,0 +1,244 @@
+/*Write a program to merge two sorted arrays of size m and n into one sorted array. Use merge-path partitioning to split the output into equal parts that are merged independently on separate threads (link with -pthread), a branchless inner merge loop, and galloping (exponential search) when one array is much smaller than the other. Option 2 benchmarks all methods on balanced, skewed and duplicate-heavy inputs.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+/* The textbook merge from code117.c, kept as the baseline. */
+void mergeSimple(int *a, int m, int *b, int n, int *out) {
+    int i = 0, j = 0, k = 0;
+    while (i < m && j < n) {
+        if (a[i] <= b[j]) {
+            out[k++] = a[i++];
+        } else {
+            out[k++] = b[j++];
+        }
+    }
+    while (i < m) {
+        out[k++] = a[i++];
+    }
+    while (j < n) {
+        out[k++] = b[j++];
+    }
+}
+
+/* Merges a[i..iEnd) and b[j..jEnd) without a data-dependent branch in the loop body. */
+void mergeBranchless(int *a, int i, int iEnd, int *b, int j, int jEnd, int *out) {
+    while (i < iEnd && j < jEnd) {
+        int x = a[i], y = b[j];
+        int takeA = x <= y;
+        *out++ = takeA ? x : y;
+        i += takeA;
+        j += !takeA;
+    }
+    memcpy(out, a + i, (size_t)(iEnd - i) * sizeof(int));
+    out += iEnd - i;
+    memcpy(out, b + j, (size_t)(jEnd - j) * sizeof(int));
+}
+
+/* Returns how many elements of a come before output position diag (ties go to a). */
+int mergePathSplit(int *a, int m, int *b, int n, long long diag) {
+    int lo = diag > n ? (int)(diag - n) : 0;
+    int hi = diag < m ? (int)diag : m;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (a[mid] <= b[diag - mid - 1]) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+typedef struct {
+    int *a, *b, *out;
+    int m, n;
+    int part, parts;
+} MergePart;
+
+/* Merges output positions [total * part / parts, total * (part + 1) / parts). Both split
+   points are found here, so a part needs nothing from any other part. */
+void *mergePart(void *arg) {
+    MergePart *p = (MergePart *)arg;
+    long long total = (long long)p->m + p->n;
+    long long diagStart = total * p->part / p->parts, diagEnd = total * (p->part + 1) / p->parts;
+    int iStart = mergePathSplit(p->a, p->m, p->b, p->n, diagStart);
+    int iEnd = mergePathSplit(p->a, p->m, p->b, p->n, diagEnd);
+    int jStart = (int)(diagStart - iStart), jEnd = (int)(diagEnd - iEnd);
+    mergeBranchless(p->a, iStart, iEnd, p->b, jStart, jEnd, p->out + diagStart);
+    return NULL;
+}
+
+/* Splits the output into one part of equal length per thread and merges the parts in parallel. */
+void mergePath(int *a, int m, int *b, int n, int *out, int threads) {
+    MergePart *parts = (MergePart *)malloc(threads * sizeof(MergePart));
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        MergePart part = {a, b, out, m, n, t, threads};
+        parts[t] = part;
+    }
+    /* The calling thread takes part 0. */
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, mergePart, &parts[t]);
+    }
+    mergePart(&parts[0]);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(parts);
+    free(ids);
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+/* Wall-clock time; clock() would add up the CPU time of all threads. */
+double wallSeconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* First index in b[from..n) whose value is >= x, found by doubling the step and then bisecting. */
+int gallop(int *b, int from, int n, int x) {
+    int bound = 1;
+    while (from + bound <= n && b[from + bound - 1] < x) {
+        bound *= 2;
+    }
+    int lo = from + bound / 2;
+    int hi = from + bound - 1 < n ? from + bound - 1 : n;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+        if (b[mid] < x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+/* For m much smaller than n: O(m log(n/m)) comparisons, and the runs of b are block-copied. */
+void mergeGalloping(int *a, int m, int *b, int n, int *out) {
+    int j = 0, k = 0;
+    for (int i = 0; i < m; i++) {
+        int next = gallop(b, j, n, a[i]);
+        memcpy(out + k, b + j, (size_t)(next - j) * sizeof(int));
+        k += next - j;
+        j = next;
+        out[k++] = a[i];
+    }
+    memcpy(out + k, b + j, (size_t)(n - j) * sizeof(int));
+}
+
+int compareInts(const void *a, const void *b) {
+    int x = *(const int *)a, y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+int *randomSorted(int size, int range) {
+    int *arr = (int *)malloc(size * sizeof(int));
+    for (int i = 0; i < size; i++) {
+        arr[i] = rand() % range;
+    }
+    qsort(arr, size, sizeof(int), compareInts);
+    return arr;
+}
+
+void benchmark(const char *name, int m, int n, int range) {
+    int *a = randomSorted(m, range);
+    int *b = randomSorted(n, range);
+    int *expected = (int *)malloc(((size_t)m + n) * sizeof(int));
+    int *out = (int *)malloc(((size_t)m + n) * sizeof(int));
+    clock_t start;
+    double wallStart;
+    /* Touch the output pages up front so page faults are not charged to the first method. */
+    memset(expected, 0, ((size_t)m + n) * sizeof(int));
+    memset(out, 0, ((size_t)m + n) * sizeof(int));
+
+    printf("%s (m = %d, n = %d):\n", name, m, n);
+    start = clock();
+    mergeSimple(a, m, b, n, expected);
+    printf("  simple merge:     %8.2f ms\n", 1000.0 * (clock() - start) / CLOCKS_PER_SEC);
+
+    start = clock();
+    mergeBranchless(a, 0, m, b, 0, n, out);
+    printf("  branchless merge: %8.2f ms %s\n", 1000.0 * (clock() - start) / CLOCKS_PER_SEC,
+           memcmp(out, expected, ((size_t)m + n) * sizeof(int)) == 0 ? "" : "(WRONG)");
+
+    /* Wall-clock time, from 1 thread up to one per core (and at least 4). */
+    int maxThreads = coreCount() > 4 ? coreCount() : 4;
+    for (int threads = 1; threads <= maxThreads; threads *= 2) {
+        memset(out, 0, ((size_t)m + n) * sizeof(int));
+        wallStart = wallSeconds();
+        mergePath(a, m, b, n, out, threads);
+        printf("  merge path (%2d):  %8.2f ms %s\n", threads, 1000.0 * (wallSeconds() - wallStart),
+               memcmp(out, expected, ((size_t)m + n) * sizeof(int)) == 0 ? "" : "(WRONG)");
+    }
+
+    start = clock();
+    mergeGalloping(a, m, b, n, out);
+    printf("  galloping merge:  %8.2f ms %s\n", 1000.0 * (clock() - start) / CLOCKS_PER_SEC,
+           memcmp(out, expected, ((size_t)m + n) * sizeof(int)) == 0 ? "" : "(WRONG)");
+
+    free(a);
+    free(b);
+    free(expected);
+    free(out);
+}
+
+int main() {
+    int choice, m, n;
+    printf("Enter 1 to merge two arrays, 2 to run the benchmark: ");
+    scanf("%d", &choice);
+    if (choice == 2) {
+        srand(42);
+        benchmark("Balanced", 10000000, 10000000, 1000000000);
+        benchmark("Skewed", 1000, 20000000, 1000000000);
+        benchmark("Duplicate-heavy", 10000000, 10000000, 16);
+        return 0;
+    }
+
+    printf("Enter size of first sorted array: ");
+    scanf("%d", &m);
+    int *arr1 = (int *)malloc((m + 1) * sizeof(int));
+    printf("Enter elements of first sorted array:\n");
+    for (int i = 0; i < m; i++) {
+        scanf("%d", &arr1[i]);
+    }
+    printf("Enter size of second sorted array: ");
+    scanf("%d", &n);
+    int *arr2 = (int *)malloc((n + 1) * sizeof(int));
+    printf("Enter elements of second sorted array:\n");
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &arr2[i]);
+    }
+    int *merged = (int *)malloc(((size_t)m + n + 1) * sizeof(int));
+
+    /* Galloping only pays off when one side is much shorter than the other. */
+    if (m * 64LL < n) {
+        mergeGalloping(arr1, m, arr2, n, merged);
+    } else if (n * 64LL < m) {
+        mergeGalloping(arr2, n, arr1, m, merged);
+    } else {
+        /* Threads only pay off once each has a few hundred thousand elements to merge. */
+        long long perThread = 1 << 18;
+        int threads = (m + (long long)n) / perThread < coreCount() ? (int)((m + (long long)n) / perThread) : coreCount();
+        mergePath(arr1, m, arr2, n, merged, threads < 1 ? 1 : threads);
+    }
+
+    printf("Merged sorted array:\n");
+    for (int i = 0; i < m + n; i++) {
+        printf("%d ", merged[i]);
+    }
+    printf("\n");
+    free(arr1);
+    free(arr2);
+    free(merged);
+    return 0;
+}
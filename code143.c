@@ -0,0 +1,152 @@
+/*Write a program to take an integer array as input in which one element is repeated, and print the first repeated element. Values can be any 64-bit integers, including negative ones. Offer three modes and print the extra memory each one uses:
+1. a bitset sized to the range between the smallest and largest value,
+2. Floyd's cycle detection for arrays of n+1 values in 1..n, using O(1) extra memory,
+3. an open-addressing hash set for values of unbounded range.*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Bitset mode: one bit per value in [min, max]. */
+int findWithBitset(long long *arr, int n, long long *repeated, size_t *bytesUsed) {
+    long long min = arr[0], max = arr[0];
+    for (int i = 1; i < n; i++) {
+        if (arr[i] < min) {
+            min = arr[i];
+        }
+        if (arr[i] > max) {
+            max = arr[i];
+        }
+    }
+    unsigned long long range = (unsigned long long)max - (unsigned long long)min + 1;
+    if (range == 0 || range > (1ULL << 36)) {
+        printf("Value range is too wide for a bitset, use the hash set mode.\n");
+        return -1;
+    }
+    size_t words = (size_t)((range + 63) / 64);
+    unsigned long long *bits = (unsigned long long *)calloc(words, sizeof(unsigned long long));
+    if (bits == NULL) {
+        printf("Not enough memory for the bitset.\n");
+        return -1;
+    }
+    *bytesUsed = words * sizeof(unsigned long long);
+    int found = 0;
+    for (int i = 0; i < n; i++) {
+        unsigned long long offset = (unsigned long long)arr[i] - (unsigned long long)min;
+        unsigned long long mask = 1ULL << (offset % 64);
+        if (bits[offset / 64] & mask) {
+            *repeated = arr[i];
+            found = 1;
+            break;
+        }
+        bits[offset / 64] |= mask;
+    }
+    free(bits);
+    return found;
+}
+
+/* Floyd mode: with n+1 values in 1..n, i -> arr[i] is a linked list whose cycle entry is the duplicate. */
+int findWithFloyd(long long *arr, int n, long long *repeated, size_t *bytesUsed) {
+    for (int i = 0; i < n; i++) {
+        if (arr[i] < 1 || arr[i] > n - 1) {
+            printf("Floyd mode needs n values in the range 1 to %d.\n", n - 1);
+            return -1;
+        }
+    }
+    *bytesUsed = 0;
+    long long slow = arr[0], fast = arr[arr[0]];
+    while (slow != fast) {
+        slow = arr[slow];
+        fast = arr[arr[fast]];
+    }
+    slow = 0;
+    while (slow != fast) {
+        slow = arr[slow];
+        fast = arr[fast];
+    }
+    *repeated = slow;
+    return 1;
+}
+
+unsigned long long mix64(unsigned long long x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/* Hash set mode: linear probing in a power-of-two table kept at most half full. */
+int findWithHashSet(long long *arr, int n, long long *repeated, size_t *bytesUsed) {
+    size_t capacity = 16;
+    while (capacity < (size_t)n * 2) {
+        capacity *= 2;
+    }
+    long long *keys = (long long *)malloc(capacity * sizeof(long long));
+    unsigned char *used = (unsigned char *)calloc(capacity, 1);
+    if (keys == NULL || used == NULL) {
+        printf("Not enough memory for the hash set.\n");
+        free(keys);
+        free(used);
+        return -1;
+    }
+    *bytesUsed = capacity * (sizeof(long long) + 1);
+    int found = 0;
+    for (int i = 0; i < n && !found; i++) {
+        size_t slot = (size_t)mix64((unsigned long long)arr[i]) & (capacity - 1);
+        while (used[slot]) {
+            if (keys[slot] == arr[i]) {
+                *repeated = arr[i];
+                found = 1;
+                break;
+            }
+            slot = (slot + 1) & (capacity - 1);
+        }
+        if (!found) {
+            used[slot] = 1;
+            keys[slot] = arr[i];
+        }
+    }
+    free(keys);
+    free(used);
+    return found;
+}
+
+int main() {
+    int n, mode, result;
+    long long repeatedElement = 0;
+    size_t bytesUsed = 0;
+    printf("Enter the number of elements in the array: ");
+    scanf("%d", &n);
+    if (n < 2) {
+        printf("At least two elements are needed.\n");
+        return 1;
+    }
+    long long *arr = (long long *)malloc(n * sizeof(long long));
+    printf("Enter the elements of the array (one element will be repeated):\n");
+    for (int i = 0; i < n; i++) {
+        scanf("%lld", &arr[i]);
+    }
+    printf("Enter mode (1 = bitset, 2 = Floyd cycle detection, 3 = hash set): ");
+    scanf("%d", &mode);
+
+    if (mode == 1) {
+        result = findWithBitset(arr, n, &repeatedElement, &bytesUsed);
+    } else if (mode == 2) {
+        result = findWithFloyd(arr, n, &repeatedElement, &bytesUsed);
+    } else if (mode == 3) {
+        result = findWithHashSet(arr, n, &repeatedElement, &bytesUsed);
+    } else {
+        printf("Invalid mode\n");
+        free(arr);
+        return 1;
+    }
+
+    if (result == 1) {
+        printf("The repeated element is: %lld\n", repeatedElement);
+        printf("Extra memory used: %zu bytes\n", bytesUsed);
+    } else if (result == 0) {
+        printf("No repeated element found.\n");
+    }
+    free(arr);
+    return result == -1 ? 1 : 0;
+}
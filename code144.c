@@ -0,0 +1,266 @@
+/*Write a program to find every repeated value in a file of integers that is larger than memory, and print each repeated value together with how many times it appears. Work in two phases: first hash-partition the input into spill files so that equal values always land in the same file and each file fits in memory, then count the spill files with in-memory hash tables, one partition per thread at a time (link with -pthread). The number of partitions is derived from a memory budget. The input can be a text file or a binary file of 64-bit integers; the result is written to a text file as "value count" lines.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define WRITE_BUFFER 4096
+#define BYTES_PER_KEY 96       /* peak phase-2 memory per distinct key, see countPartition */
+#define MAX_PARTS 1000         /* spill files open at the same time */
+
+unsigned long long mix64(unsigned long long x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+int readValue(FILE *fp, int format, long long *value) {
+    if (format == 2) {
+        return fread(value, sizeof(long long), 1, fp) == 1;
+    }
+    return fscanf(fp, "%lld", value) == 1;
+}
+
+/* Phase 1: the high half of the hash picks the partition, so the low half stays random
+   inside each partition for the hash table in phase 2. The spill files come from tmpfile(),
+   so they never clash with existing files and are deleted when closed or when the program
+   exits, on error paths included. Returns the open spill files, rewound, or NULL. */
+FILE **partitionInput(FILE *in, int format, int parts) {
+    FILE **spill = (FILE **)calloc(parts, sizeof(FILE *));
+    long long *buffers = (long long *)malloc((size_t)parts * WRITE_BUFFER * sizeof(long long));
+    int *fill = (int *)calloc(parts, sizeof(int));
+    for (int p = 0; p < parts; p++) {
+        spill[p] = tmpfile();
+        if (spill[p] == NULL) {
+            printf("Error creating spill file.\n");
+            for (int q = 0; q < p; q++) {
+                fclose(spill[q]);
+            }
+            free(spill);
+            free(buffers);
+            free(fill);
+            return NULL;
+        }
+    }
+    long long value;
+    while (readValue(in, format, &value)) {
+        int p = (int)((mix64((unsigned long long)value) >> 32) % parts);
+        long long *buf = buffers + (size_t)p * WRITE_BUFFER;
+        buf[fill[p]++] = value;
+        if (fill[p] == WRITE_BUFFER) {
+            fwrite(buf, sizeof(long long), WRITE_BUFFER, spill[p]);
+            fill[p] = 0;
+        }
+    }
+    for (int p = 0; p < parts; p++) {
+        fwrite(buffers + (size_t)p * WRITE_BUFFER, sizeof(long long), fill[p], spill[p]);
+        rewind(spill[p]);
+    }
+    free(buffers);
+    free(fill);
+    return spill;
+}
+
+/* Open-addressing table of (key, count) pairs, kept at most half full. */
+typedef struct {
+    long long *keys;
+    long long *counts;
+    size_t capacity;
+    size_t size;
+} CountTable;
+
+int tableInit(CountTable *t, size_t capacity) {
+    t->keys = (long long *)malloc(capacity * sizeof(long long));
+    t->counts = (long long *)calloc(capacity, sizeof(long long));
+    t->capacity = capacity;
+    t->size = 0;
+    if (t->keys == NULL || t->counts == NULL) {
+        free(t->keys);
+        free(t->counts);
+        return 0;
+    }
+    return 1;
+}
+
+/* Returns the slot holding key, or the empty slot where it belongs. */
+size_t tableSlot(CountTable *t, long long key) {
+    size_t slot = (size_t)mix64((unsigned long long)key) & (t->capacity - 1);
+    while (t->counts[slot] != 0 && t->keys[slot] != key) {
+        slot = (slot + 1) & (t->capacity - 1);
+    }
+    return slot;
+}
+
+/* Doubles the capacity; the old table is freed only once the new one is filled. */
+int tableGrow(CountTable *t) {
+    CountTable bigger;
+    if (!tableInit(&bigger, t->capacity * 2)) {
+        return 0;
+    }
+    for (size_t slot = 0; slot < t->capacity; slot++) {
+        if (t->counts[slot] != 0) {
+            size_t to = tableSlot(&bigger, t->keys[slot]);
+            bigger.keys[to] = t->keys[slot];
+            bigger.counts[to] = t->counts[slot];
+        }
+    }
+    bigger.size = t->size;
+    free(t->keys);
+    free(t->counts);
+    *t = bigger;
+    return 1;
+}
+
+/* Phase 2: stream one spill file into a table that grows with the number of distinct keys,
+   so a hot key costs one slot however often it repeats, and report keys seen more than once.
+   The table has 2 to 4 slots of 16 bytes per distinct key, and 6 while it is being doubled,
+   hence BYTES_PER_KEY. The lines of one partition are written under the output's lock, so
+   they stay together when several threads write. Returns -1 when memory runs out. */
+long long countPartition(FILE *fp, FILE *out) {
+    long long buf[WRITE_BUFFER];
+    CountTable t;
+    if (!tableInit(&t, 1024)) {
+        fclose(fp);
+        return -1;
+    }
+    size_t len;
+    while ((len = fread(buf, sizeof(long long), WRITE_BUFFER, fp)) > 0) {
+        for (size_t i = 0; i < len; i++) {
+            size_t slot = tableSlot(&t, buf[i]);
+            if (t.counts[slot] == 0) {
+                if ((t.size + 1) * 2 > t.capacity) {
+                    if (!tableGrow(&t)) {
+                        fclose(fp);
+                        free(t.keys);
+                        free(t.counts);
+                        return -1;
+                    }
+                    slot = tableSlot(&t, buf[i]);
+                }
+                t.keys[slot] = buf[i];
+                t.size++;
+            }
+            t.counts[slot]++;
+        }
+    }
+    fclose(fp);
+
+    long long duplicates = 0;
+    flockfile(out);
+    for (size_t slot = 0; slot < t.capacity; slot++) {
+        if (t.counts[slot] > 1) {
+            fprintf(out, "%lld %lld\n", t.keys[slot], t.counts[slot]);
+            duplicates++;
+        }
+    }
+    funlockfile(out);
+    free(t.keys);
+    free(t.counts);
+    return duplicates;
+}
+
+/* Threads take partitions from a shared counter until none are left. */
+typedef struct {
+    FILE **spill;
+    int parts;
+    int next;
+    FILE *out;
+    long long total;
+    int failed;
+    pthread_mutex_t lock;
+} SharedWork;
+
+void *worker(void *arg) {
+    SharedWork *work = (SharedWork *)arg;
+    for (;;) {
+        pthread_mutex_lock(&work->lock);
+        int p = work->next++;
+        pthread_mutex_unlock(&work->lock);
+        if (p >= work->parts) {
+            return NULL;
+        }
+        long long found = countPartition(work->spill[p], work->out);
+        pthread_mutex_lock(&work->lock);
+        if (found < 0) {
+            work->failed = 1;
+        } else {
+            work->total += found;
+        }
+        pthread_mutex_unlock(&work->lock);
+    }
+}
+
+int main() {
+    char inputName[256], outputName[256];
+    int format;
+    long long budget;
+    printf("Enter the input file name: ");
+    scanf("%255s", inputName);
+    printf("Enter input format (1 = text, 2 = binary 64-bit): ");
+    scanf("%d", &format);
+    printf("Enter the output file name: ");
+    scanf("%255s", outputName);
+    printf("Enter the memory budget in MB: ");
+    scanf("%lld", &budget);
+    if (budget < 1) {
+        budget = 1;
+    }
+
+    FILE *in = fopen(inputName, format == 2 ? "rb" : "r");
+    if (in == NULL) {
+        printf("Error opening input file.\n");
+        return 1;
+    }
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+    /* Every thread holds one partition table at a time. The value count bounds the distinct
+       count, and a text value takes at least 2 bytes (digit and separator), so the partition
+       count is an upper bound; repeated values only make the tables smaller. */
+    fseek(in, 0, SEEK_END);
+    long long values = ftell(in) / (format == 2 ? (long long)sizeof(long long) : 2);
+    rewind(in);
+    long long perPartition = budget * 1024 * 1024 / threads / BYTES_PER_KEY;
+    long long wanted = perPartition > 0 ? values / perPartition + 1 : values + 1;
+    int parts = wanted > MAX_PARTS ? MAX_PARTS : (int)wanted;
+    if (wanted > MAX_PARTS) {
+        printf("Warning: the budget needs %lld partitions; using %d, which may not fit.\n", wanted, MAX_PARTS);
+    }
+    threads = threads < parts ? threads : parts;
+    printf("Using %d partitions and %d threads.\n", parts, threads);
+
+    FILE **spill = partitionInput(in, format, parts);
+    fclose(in);
+    if (spill == NULL) {
+        return 1;
+    }
+
+    FILE *out = fopen(outputName, "w");
+    if (out == NULL) {
+        printf("Error opening output file.\n");
+        for (int p = 0; p < parts; p++) {
+            fclose(spill[p]);
+        }
+        free(spill);
+        return 1;
+    }
+    SharedWork work = {spill, parts, 0, out, 0, 0, PTHREAD_MUTEX_INITIALIZER};
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        pthread_create(&ids[t], NULL, worker, &work);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(ids);
+    free(spill);
+    fclose(out);
+    if (work.failed) {
+        printf("Not enough memory for a partition; use a larger budget or fewer threads.\n");
+        return 1;
+    }
+    printf("Found %lld repeated values, written to %s\n", work.total, outputName);
+    return 0;
+}
@@ -0,0 +1,122 @@
+/*Write a program to find the missing numbers in a file that should contain every integer from 0 to n exactly once, where n can be as large as a 64-bit integer allows. Exactly one or exactly two numbers are missing. Read the file as a stream in one pass, without storing the numbers. One missing number is the XOR of the values against 0..n; two are found from the sum and the sum of squares, kept modulo 2^128 so that nothing can overflow. The file can be text or binary (unsigned 64-bit integers).*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BLOCK 65536
+
+/* Unsigned arithmetic wraps, so sums kept modulo 2^128 never overflow; the differences
+   used below are smaller than 2^128 and therefore come out exact. */
+typedef unsigned __int128 uint128;
+
+/* Sum of 0..n and sum of their squares, modulo 2^128. Each factor is divided by 2 or 3
+   before multiplying, so the division is exact. */
+uint128 expectedSum(unsigned long long n) {
+    uint128 x = n, y = (uint128)n + 1;
+    return x % 2 == 0 ? x / 2 * y : y / 2 * x;
+}
+
+uint128 expectedSquares(unsigned long long n) {
+    uint128 x = n, y = (uint128)n + 1, z = 2 * (uint128)n + 1;
+    if (x % 2 == 0) {
+        x /= 2;
+    } else {
+        y /= 2;
+    }
+    if (x % 3 == 0) {
+        x /= 3;
+    } else if (y % 3 == 0) {
+        y /= 3;
+    } else {
+        z /= 3;
+    }
+    return x * y * z;
+}
+
+/* Largest r with r * r <= x, one bit at a time from the top. */
+unsigned long long squareRoot(uint128 x) {
+    unsigned long long r = 0;
+    for (int bit = 63; bit >= 0; bit--) {
+        unsigned long long candidate = r | (1ULL << bit);
+        if ((uint128)candidate * candidate <= x) {
+            r = candidate;
+        }
+    }
+    return r;
+}
+
+/* Reads up to max values; binary input is read in large blocks. */
+size_t readBlock(FILE *fp, int format, unsigned long long *buf, size_t max) {
+    if (format == 2) {
+        return fread(buf, sizeof(unsigned long long), max, fp);
+    }
+    size_t count = 0;
+    while (count < max && fscanf(fp, "%llu", &buf[count]) == 1) {
+        count++;
+    }
+    return count;
+}
+
+int main() {
+    unsigned long long n;
+    int format, missing;
+    char fileName[256];
+    printf("Enter n (the file should hold 0 to n): ");
+    scanf("%llu", &n);
+    printf("Enter how many numbers are missing (1 or 2): ");
+    scanf("%d", &missing);
+    printf("Enter the file name: ");
+    scanf("%255s", fileName);
+    printf("Enter file format (1 = text, 2 = binary 64-bit): ");
+    scanf("%d", &format);
+    if (missing != 1 && missing != 2) {
+        printf("Only 1 or 2 missing numbers are supported.\n");
+        return 1;
+    }
+
+    FILE *fp = fopen(fileName, format == 2 ? "rb" : "r");
+    if (fp == NULL) {
+        printf("Error opening file.\n");
+        return 1;
+    }
+    unsigned long long *buf = (unsigned long long *)malloc(BLOCK * sizeof(unsigned long long));
+    unsigned long long total = 0, count = 0;
+    uint128 sum = 0, squares = 0;
+    size_t len;
+    while ((len = readBlock(fp, format, buf, BLOCK)) > 0) {
+        if (missing == 1) {
+            for (size_t i = 0; i < len; i++) {
+                total ^= buf[i];
+            }
+        } else {
+            for (size_t i = 0; i < len; i++) {
+                sum += buf[i];
+                squares += (uint128)buf[i] * buf[i];
+            }
+        }
+        count += len;
+    }
+    fclose(fp);
+    free(buf);
+
+    if (count != n + 1 - missing) {
+        printf("Expected %llu numbers but read %llu.\n", n + 1 - missing, count);
+        return 1;
+    }
+
+    /* XOR of 0..n in closed form: it repeats with period 4. */
+    if (missing == 1) {
+        unsigned long long expected[4] = {n, 1, n + 1, 0};
+        printf("The missing number is: %llu\n", expected[n % 4] ^ total);
+        return 0;
+    }
+
+    /* s = a + b < 2^65 and q = a^2 + b^2, so (b - a)^2 = 2q - s^2 < 2^128 is exact even
+       though q itself may have wrapped. */
+    uint128 s = expectedSum(n) - sum;
+    uint128 q = expectedSquares(n) - squares;
+    unsigned long long d = squareRoot(2 * q - s * s);
+    unsigned long long a = (unsigned long long)((s - d) / 2);
+    unsigned long long b = a + d;
+    printf("The missing numbers are: %llu %llu\n", a, b);
+    return 0;
+}
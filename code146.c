@@ -0,0 +1,289 @@
+/*Write a program to find frequent elements in a large log of integers read from a file (or from standard input when the file name is "-").
+Mode 1 prints the majority element (more than n/2 occurrences) or -1. A file is split into one byte range per core; each thread cuts its range into blocks, Boyer-Moore voting turns each block into a (candidate, count) summary, the summaries of all threads are merged, and a second parallel pass verifies the winner (link with -pthread). Standard input is read as one sequence of blocks.
+Mode 2 prints every element that occurs more than n/k times using the Misra-Gries algorithm with only k-1 counters, so it works on unbounded streams. When the input is a file the counts are verified with a second pass; on standard input the printed counts are lower bounds.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define BLOCK 65536
+
+typedef struct {
+    int candidate;
+    long long count;
+} Vote;
+
+/* Boyer-Moore voting over one block. */
+Vote voteBlock(int *arr, int len) {
+    Vote v = {0, 0};
+    for (int i = 0; i < len; i++) {
+        if (v.count == 0) {
+            v.candidate = arr[i];
+        }
+        if (arr[i] == v.candidate) {
+            v.count++;
+        } else {
+            v.count--;
+        }
+    }
+    return v;
+}
+
+/* Two summaries cancel each other the same way single votes do, so blocks can be
+   summarised independently and combined in any order. */
+Vote mergeVotes(Vote a, Vote b) {
+    if (a.candidate == b.candidate) {
+        a.count += b.count;
+        return a;
+    }
+    if (a.count >= b.count) {
+        a.count -= b.count;
+        return a;
+    }
+    b.count -= a.count;
+    return b;
+}
+
+/* Misra-Gries summary with at most k-1 counters. */
+typedef struct {
+    int *keys;
+    long long *counts;
+    int size;
+    int capacity;
+} Summary;
+
+void summaryAdd(Summary *s, int x) {
+    for (int i = 0; i < s->size; i++) {
+        if (s->keys[i] == x) {
+            s->counts[i]++;
+            return;
+        }
+    }
+    if (s->size < s->capacity) {
+        s->keys[s->size] = x;
+        s->counts[s->size++] = 1;
+        return;
+    }
+    /* No free counter: decrement all and drop the ones that reach zero. */
+    int kept = 0;
+    for (int i = 0; i < s->size; i++) {
+        if (--s->counts[i] > 0) {
+            s->keys[kept] = s->keys[i];
+            s->counts[kept++] = s->counts[i];
+        }
+    }
+    s->size = kept;
+}
+
+/* One thread's share of a file: the numbers whose first character lies in [start, end). */
+typedef struct {
+    const char *fileName;
+    long long start, end;
+    int countOnly;      /* 0: vote, 1: count occurrences of candidate */
+    int candidate;
+    Vote vote;
+    long long n;
+    long long count;
+} RangeWork;
+
+/* Parses the numbers of one byte range with getc_unlocked (the FILE is private to this
+   thread), keeping track of the offset so the range ends exactly where the next one starts.
+   A number that straddles start belongs to the previous range. Full blocks are voted with
+   voteBlock and merged with mergeVotes. */
+void *scanRange(void *arg) {
+    RangeWork *w = (RangeWork *)arg;
+    FILE *fp = fopen(w->fileName, "r");
+    int *buf = (int *)malloc(BLOCK * sizeof(int));
+    int len = 0;
+    Vote total = {0, 0};
+    w->n = 0;
+    w->count = 0;
+    if (fp == NULL || buf == NULL) {
+        free(buf);
+        return NULL;
+    }
+    long long pos = w->start > 0 ? w->start - 1 : 0;
+    fseek(fp, pos, SEEK_SET);
+    int c = getc_unlocked(fp);
+    pos++;
+    if (w->start > 0) {
+        while (c != EOF && !isspace(c)) {
+            c = getc_unlocked(fp);
+            pos++;
+        }
+    }
+    for (;;) {
+        while (c != EOF && isspace(c)) {
+            c = getc_unlocked(fp);
+            pos++;
+        }
+        if (c == EOF || pos - 1 >= w->end) {
+            break;
+        }
+        int negative = c == '-';
+        if (c == '-' || c == '+') {
+            c = getc_unlocked(fp);
+            pos++;
+        }
+        if (!isdigit(c)) {
+            break;
+        }
+        long long value = 0;
+        while (isdigit(c)) {
+            value = value * 10 + (c - '0');
+            c = getc_unlocked(fp);
+            pos++;
+        }
+        int x = (int)(negative ? -value : value);
+        if (w->countOnly) {
+            w->count += x == w->candidate;
+        } else {
+            buf[len++] = x;
+            if (len == BLOCK) {
+                total = mergeVotes(total, voteBlock(buf, len));
+                len = 0;
+            }
+        }
+        w->n++;
+    }
+    if (len > 0) {
+        total = mergeVotes(total, voteBlock(buf, len));
+    }
+    w->vote = total;
+    fclose(fp);
+    free(buf);
+    return NULL;
+}
+
+/* Runs scanRange over equal byte ranges of the file, one thread per range. */
+void scanFileParallel(const char *fileName, long long size, RangeWork *work, int threads, int countOnly,
+                      int candidate) {
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        RangeWork w = {fileName, size * t / threads, size * (t + 1) / threads, countOnly, candidate, {0, 0}, 0, 0};
+        work[t] = w;
+        pthread_create(&ids[t], NULL, scanRange, &work[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(ids);
+}
+
+int readBlock(FILE *fp, int *buf, int max) {
+    int count = 0;
+    while (count < max && fscanf(fp, "%d", &buf[count]) == 1) {
+        count++;
+    }
+    return count;
+}
+
+int main() {
+    char fileName[256];
+    int mode, k = 2;
+    printf("Enter the file name (- for standard input): ");
+    scanf("%255s", fileName);
+    printf("Enter mode (1 = majority element, 2 = elements above n/k): ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter k: ");
+        scanf("%d", &k);
+        if (k < 2) {
+            printf("k must be at least 2\n");
+            return 1;
+        }
+    }
+
+    int fromStdin = fileName[0] == '-' && fileName[1] == '\0';
+    FILE *fp = fromStdin ? stdin : fopen(fileName, "r");
+    if (fp == NULL) {
+        printf("Error opening file.\n");
+        return 1;
+    }
+    int *buf = (int *)malloc(BLOCK * sizeof(int));
+    long long n = 0;
+    int len;
+
+    if (mode == 1 && !fromStdin) {
+        /* A file can be split by byte offset: every thread summarises its own range, the
+           summaries are merged, and a second parallel pass counts the winner. */
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        int threads = cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+        fseek(fp, 0, SEEK_END);
+        long long size = ftell(fp);
+        RangeWork *work = (RangeWork *)malloc(threads * sizeof(RangeWork));
+        Vote total = {0, 0};
+        scanFileParallel(fileName, size, work, threads, 0, 0);
+        for (int t = 0; t < threads; t++) {
+            total = mergeVotes(total, work[t].vote);
+            n += work[t].n;
+        }
+        long long count = 0;
+        scanFileParallel(fileName, size, work, threads, 1, total.candidate);
+        for (int t = 0; t < threads; t++) {
+            count += work[t].count;
+        }
+        if (n > 0 && count > n / 2) {
+            printf("Majority element: %d\n", total.candidate);
+        } else {
+            printf("Majority element: -1\n");
+        }
+        free(work);
+    } else if (mode == 1) {
+        Vote total = {0, 0};
+        while ((len = readBlock(fp, buf, BLOCK)) > 0) {
+            total = mergeVotes(total, voteBlock(buf, len));
+            n += len;
+        }
+        printf("Majority candidate: %d (cannot verify a stream that was not stored)\n", total.candidate);
+    } else {
+        Summary s;
+        s.capacity = k - 1;
+        s.size = 0;
+        s.keys = (int *)malloc(s.capacity * sizeof(int));
+        s.counts = (long long *)malloc(s.capacity * sizeof(long long));
+        while ((len = readBlock(fp, buf, BLOCK)) > 0) {
+            for (int i = 0; i < len; i++) {
+                summaryAdd(&s, buf[i]);
+            }
+            n += len;
+        }
+        if (!fromStdin) {
+            /* The summary only keeps candidates; a second pass gives their exact counts. */
+            for (int i = 0; i < s.size; i++) {
+                s.counts[i] = 0;
+            }
+            rewind(fp);
+            while ((len = readBlock(fp, buf, BLOCK)) > 0) {
+                for (int i = 0; i < len; i++) {
+                    for (int j = 0; j < s.size; j++) {
+                        if (s.keys[j] == buf[i]) {
+                            s.counts[j]++;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        int printed = 0;
+        printf("%s occurring more than %lld times:\n", fromStdin ? "Candidates for elements" : "Elements", n / k);
+        for (int i = 0; i < s.size; i++) {
+            if (fromStdin || s.counts[i] > n / k) {
+                printf("%d (%s %lld)\n", s.keys[i], fromStdin ? "at least" : "count", s.counts[i]);
+                printed++;
+            }
+        }
+        if (printed == 0) {
+            printf("-1\n");
+        }
+        free(s.keys);
+        free(s.counts);
+    }
+
+    if (!fromStdin) {
+        fclose(fp);
+    }
+    free(buf);
+    return 0;
+}
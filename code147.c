@@ -0,0 +1,158 @@
+/*Write a Program to take an integer array nums as input and print an array answer such that answer[i] is the product of all the elements of nums except nums[i], without using division. Products are computed in 64 bits and any answer that does not fit is printed as "overflow" (mode 1), or every product is taken modulo a prime p (mode 2). Both prefix and suffix passes are done as block scans: every block is reduced on its own, the block totals are scanned, and then every block is finished on its own; the first and last phase share the blocks out between threads (link with -pthread).*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define BLOCK 4096
+
+/* A partial product. A range containing a zero is exactly 0 even if the rest overflowed. */
+typedef struct {
+    long long value;
+    int overflow;
+} Product;
+
+long long modulus = 0;
+
+Product combine(Product a, Product b) {
+    Product r = {0, 0};
+    if ((a.value == 0 && !a.overflow) || (b.value == 0 && !b.overflow)) {
+        return r;
+    }
+    if (modulus > 0) {
+        r.value = (long long)((unsigned long long)a.value * (unsigned long long)b.value % (unsigned long long)modulus);
+        return r;
+    }
+    if (a.overflow || b.overflow) {
+        r.value = 1;
+        r.overflow = 1;
+        return r;
+    }
+    if (__builtin_mul_overflow(a.value, b.value, &r.value)) {
+        r.value = 1;
+        r.overflow = 1;
+    }
+    return r;
+}
+
+typedef struct {
+    Product *items, *out, *totals;
+    int n, step, blocks;
+    int phase;          /* 1: reduce blocks into totals, 3: finish blocks from totals */
+    int next;           /* next block to hand out */
+} ScanWork;
+
+/* Takes blocks from next until none are left. Phases 1 and 3 only touch their own block
+   (and its slot in totals), so any thread can take any block. */
+void *scanWorker(void *arg) {
+    ScanWork *w = (ScanWork *)arg;
+    Product one = {1, 0};
+    for (;;) {
+        int b = __sync_fetch_and_add(&w->next, 1);
+        if (b >= w->blocks) {
+            return NULL;
+        }
+        int end = (b + 1) * BLOCK < w->n ? (b + 1) * BLOCK : w->n;
+        if (w->phase == 1) {
+            Product total = one;
+            for (int i = b * BLOCK; i < end; i++) {
+                total = combine(total, w->items[w->step > 0 ? i : w->n - 1 - i]);
+            }
+            w->totals[b] = total;
+        } else {
+            Product acc = w->totals[b];
+            for (int i = b * BLOCK; i < end; i++) {
+                int index = w->step > 0 ? i : w->n - 1 - i;
+                w->out[index] = acc;
+                acc = combine(acc, w->items[index]);
+            }
+        }
+    }
+}
+
+/* Runs one phase on up to threads threads; the calling thread takes blocks too. */
+void runPhase(ScanWork *w, int phase, int threads) {
+    pthread_t ids[64];
+    w->phase = phase;
+    w->next = 0;
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, scanWorker, w);
+    }
+    scanWorker(w);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+}
+
+/* Writes the exclusive scan of items into out, walking forward (step = 1) or backward (step = -1). */
+void blockScan(Product *items, Product *out, int n, int step, int threads) {
+    int blocks = (n + BLOCK - 1) / BLOCK;
+    Product *totals = (Product *)malloc((blocks + 1) * sizeof(Product));
+    Product one = {1, 0};
+    ScanWork work = {items, out, totals, n, step, blocks, 0, 0};
+    threads = threads < blocks ? threads : blocks;
+    threads = threads < 1 ? 1 : threads > 64 ? 64 : threads;
+
+    /* Phase 1: reduce every block. */
+    runPhase(&work, 1, threads);
+
+    /* Phase 2: exclusive scan of the block totals, one per BLOCK elements, so it stays serial. */
+    Product running = one;
+    for (int b = 0; b < blocks; b++) {
+        Product total = totals[b];
+        totals[b] = running;
+        running = combine(running, total);
+    }
+
+    /* Phase 3: scan inside every block, starting from its offset. */
+    runPhase(&work, 3, threads);
+    free(totals);
+}
+
+int main() {
+    int n, mode;
+    printf("Enter number of elements in the array: ");
+    scanf("%d", &n);
+    Product *nums = (Product *)malloc(n * sizeof(Product));
+    Product *left = (Product *)malloc(n * sizeof(Product));
+    Product *right = (Product *)malloc(n * sizeof(Product));
+    printf("Enter elements of the array: ");
+    for (int i = 0; i < n; i++) {
+        scanf("%lld", &nums[i].value);
+        nums[i].overflow = 0;
+    }
+    printf("Enter mode (1 = exact 64-bit, 2 = modulo p): ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter the prime p (below 2^32): ");
+        scanf("%lld", &modulus);
+        if (modulus < 2 || modulus > 4294967295LL) {
+            printf("Invalid modulus\n");
+            return 1;
+        }
+        for (int i = 0; i < n; i++) {
+            nums[i].value = (nums[i].value % modulus + modulus) % modulus;
+        }
+    }
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int threads = cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+    blockScan(nums, left, n, 1, threads);
+    blockScan(nums, right, n, -1, threads);
+
+    printf("Output array: ");
+    for (int i = 0; i < n; i++) {
+        Product answer = combine(left[i], right[i]);
+        if (answer.overflow) {
+            printf("overflow ");
+        } else {
+            printf("%lld ", answer.value);
+        }
+    }
+    printf("\n");
+
+    free(nums);
+    free(left);
+    free(right);
+    return 0;
+}
@@ -0,0 +1,125 @@
+/*Write a Program to take an array of integers as input and print its leftmost pivot index (the index where the sum of the numbers strictly to the left equals the sum of the numbers strictly to the right), or -1 if there is none. Then take q updates of the form "index value", set arr[index] = value, and print the leftmost pivot index after every update. Each update and each query takes O(log n) for non-negative arrays, using a segment tree; all sums are 64-bit.*/
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Index i is a pivot when prefix(i-1) == total - prefix(i), i.e. when
+   g(i) = 2 * prefix(i) - arr[i] equals total. The tree keeps min and max of g
+   with lazy range additions. */
+long long *minG, *maxG, *lazy;
+long long *arr;
+int n;
+
+void build(int node, int l, int r, long long *g) {
+    lazy[node] = 0;
+    if (l == r) {
+        minG[node] = maxG[node] = g[l];
+        return;
+    }
+    int mid = (l + r) / 2;
+    build(2 * node, l, mid, g);
+    build(2 * node + 1, mid + 1, r, g);
+    minG[node] = minG[2 * node] < minG[2 * node + 1] ? minG[2 * node] : minG[2 * node + 1];
+    maxG[node] = maxG[2 * node] > maxG[2 * node + 1] ? maxG[2 * node] : maxG[2 * node + 1];
+}
+
+void apply(int node, long long delta) {
+    minG[node] += delta;
+    maxG[node] += delta;
+    lazy[node] += delta;
+}
+
+void push(int node) {
+    if (lazy[node] != 0) {
+        apply(2 * node, lazy[node]);
+        apply(2 * node + 1, lazy[node]);
+        lazy[node] = 0;
+    }
+}
+
+void rangeAdd(int node, int l, int r, int from, int to, long long delta) {
+    if (to < l || r < from) {
+        return;
+    }
+    if (from <= l && r <= to) {
+        apply(node, delta);
+        return;
+    }
+    push(node);
+    int mid = (l + r) / 2;
+    rangeAdd(2 * node, l, mid, from, to, delta);
+    rangeAdd(2 * node + 1, mid + 1, r, from, to, delta);
+    minG[node] = minG[2 * node] < minG[2 * node + 1] ? minG[2 * node] : minG[2 * node + 1];
+    maxG[node] = maxG[2 * node] > maxG[2 * node + 1] ? maxG[2 * node] : maxG[2 * node + 1];
+}
+
+/* Leftmost index with g == target. Subtrees whose [min, max] cannot contain the target are
+   skipped; for non-negative arrays g is non-decreasing, so only one path is followed. */
+int findLeftmost(int node, int l, int r, long long target) {
+    if (minG[node] > target || maxG[node] < target) {
+        return -1;
+    }
+    if (l == r) {
+        return l;
+    }
+    push(node);
+    int mid = (l + r) / 2;
+    int found = findLeftmost(2 * node, l, mid, target);
+    if (found == -1) {
+        found = findLeftmost(2 * node + 1, mid + 1, r, target);
+    }
+    return found;
+}
+
+int main() {
+    int q, index;
+    long long value, totalSum = 0;
+    printf("Enter number of elements in the array: ");
+    scanf("%d", &n);
+    if (n < 1) {
+        printf("Pivot index: -1\n");
+        return 0;
+    }
+    arr = (long long *)malloc(n * sizeof(long long));
+    long long *g = (long long *)malloc(n * sizeof(long long));
+    minG = (long long *)malloc(4 * n * sizeof(long long));
+    maxG = (long long *)malloc(4 * n * sizeof(long long));
+    lazy = (long long *)malloc(4 * n * sizeof(long long));
+    printf("Enter elements of the array: ");
+    for (int i = 0; i < n; i++) {
+        scanf("%lld", &arr[i]);
+    }
+
+    long long prefix = 0;
+    for (int i = 0; i < n; i++) {
+        prefix += arr[i];
+        g[i] = 2 * prefix - arr[i];
+    }
+    totalSum = prefix;
+    build(1, 0, n - 1, g);
+    free(g);
+    printf("Pivot index: %d\n", findLeftmost(1, 0, n - 1, totalSum));
+
+    printf("Enter number of updates: ");
+    scanf("%d", &q);
+    for (int k = 0; k < q; k++) {
+        printf("Enter index and new value: ");
+        scanf("%d %lld", &index, &value);
+        if (index < 0 || index >= n) {
+            printf("Invalid index\n");
+            continue;
+        }
+        /* prefix(i) grows by delta for every i >= index, and arr[index] itself by delta. */
+        long long delta = value - arr[index];
+        arr[index] = value;
+        totalSum += delta;
+        rangeAdd(1, 0, n - 1, index, index, delta);
+        rangeAdd(1, 0, n - 1, index + 1, n - 1, 2 * delta);
+        printf("Pivot index: %d\n", findLeftmost(1, 0, n - 1, totalSum));
+    }
+
+    free(arr);
+    free(minG);
+    free(maxG);
+    free(lazy);
+    return 0;
+}
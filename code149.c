@@ -0,0 +1,162 @@
+/*Write a Program to take a sorted array (the elements might be repeated) and q query values as inputs. For every query x print the first and last occurrence of x (-1 -1 if x is not present) and the index of the ceil of x (the first element >= x, or -1). Use branchless binary search for lower_bound and upper_bound. When the queries are sorted, answer them all in one merge-like sweep over the array; otherwise run several searches side by side and prefetch their next probes.*/
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__GNUC__)
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p)
+#endif
+
+#define GROUP 8
+
+typedef struct {
+    int first;
+    int last;
+} Range;
+
+/* Index of the first element >= x. The loop always runs log2(n) times and the only
+   data-dependent step is a select, which compiles to a conditional move. */
+int lowerBound(const int *arr, int n, int x) {
+    if (n == 0) {
+        return 0;
+    }
+    const int *base = arr;
+    int len = n;
+    while (len > 1) {
+        int half = len / 2;
+        base = base[half - 1] < x ? base + half : base;
+        len -= half;
+    }
+    return (int)(base - arr) + (*base < x);
+}
+
+/* Index of the first element > x. */
+int upperBound(const int *arr, int n, int x) {
+    if (n == 0) {
+        return 0;
+    }
+    const int *base = arr;
+    int len = n;
+    while (len > 1) {
+        int half = len / 2;
+        base = base[half - 1] <= x ? base + half : base;
+        len -= half;
+    }
+    return (int)(base - arr) + (*base <= x);
+}
+
+/* [first, last) of the elements equal to x. */
+Range equalRange(const int *arr, int n, int x) {
+    Range r;
+    r.first = lowerBound(arr, n, x);
+    r.last = upperBound(arr, n, x);
+    return r;
+}
+
+/* Sorted queries: both bounds only move forward, so all queries cost O(n + q) together. */
+void sweepSorted(const int *arr, int n, const int *queries, int q, Range *out) {
+    int lo = 0, hi = 0;
+    for (int k = 0; k < q; k++) {
+        while (lo < n && arr[lo] < queries[k]) {
+            lo++;
+        }
+        if (hi < lo) {
+            hi = lo;
+        }
+        while (hi < n && arr[hi] <= queries[k]) {
+            hi++;
+        }
+        out[k].first = lo;
+        out[k].last = hi;
+    }
+}
+
+/* Runs GROUP lower_bound searches in lockstep. They all take the same number of steps, so
+   the loads of one step overlap and the next probes can be prefetched while waiting. */
+void lowerBoundGroup(const int *arr, int n, const int *queries, int count, int *out, int strict) {
+    const int *base[GROUP];
+    for (int g = 0; g < count; g++) {
+        base[g] = arr;
+    }
+    int len = n;
+    while (len > 1) {
+        int half = len / 2;
+        for (int g = 0; g < count; g++) {
+            int goRight = strict ? base[g][half - 1] <= queries[g] : base[g][half - 1] < queries[g];
+            base[g] = goRight ? base[g] + half : base[g];
+        }
+        len -= half;
+        int nextHalf = len / 2;
+        for (int g = 0; g < count && nextHalf > 0; g++) {
+            PREFETCH(base[g] + nextHalf - 1);
+        }
+    }
+    for (int g = 0; g < count; g++) {
+        int step = strict ? *base[g] <= queries[g] : *base[g] < queries[g];
+        out[g] = (int)(base[g] - arr) + step;
+    }
+}
+
+void searchInterleaved(const int *arr, int n, const int *queries, int q, Range *out) {
+    int lower[GROUP], upper[GROUP];
+    for (int k = 0; k < q; k += GROUP) {
+        int count = q - k < GROUP ? q - k : GROUP;
+        if (n == 0) {
+            for (int g = 0; g < count; g++) {
+                out[k + g].first = out[k + g].last = 0;
+            }
+            continue;
+        }
+        lowerBoundGroup(arr, n, queries + k, count, lower, 0);
+        lowerBoundGroup(arr, n, queries + k, count, upper, 1);
+        for (int g = 0; g < count; g++) {
+            out[k + g].first = lower[g];
+            out[k + g].last = upper[g];
+        }
+    }
+}
+
+int main() {
+    int n, q;
+    printf("Enter number of elements in the sorted array: ");
+    scanf("%d", &n);
+    int *nums = (int *)malloc((n + 1) * sizeof(int));
+    printf("Enter elements of the sorted array: ");
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &nums[i]);
+    }
+    printf("Enter number of queries: ");
+    scanf("%d", &q);
+    int *queries = (int *)malloc((q + 1) * sizeof(int));
+    Range *answers = (Range *)malloc((q + 1) * sizeof(Range));
+    printf("Enter the queries: ");
+    int sorted = 1;
+    for (int k = 0; k < q; k++) {
+        scanf("%d", &queries[k]);
+        if (k > 0 && queries[k] < queries[k - 1]) {
+            sorted = 0;
+        }
+    }
+
+    /* A sweep touches the whole array, so it only wins when there are many queries. */
+    if (sorted && q >= n / 16) {
+        sweepSorted(nums, n, queries, q, answers);
+    } else if (q == 1) {
+        answers[0] = equalRange(nums, n, queries[0]);
+    } else {
+        searchInterleaved(nums, n, queries, q, answers);
+    }
+
+    for (int k = 0; k < q; k++) {
+        int found = answers[k].first < answers[k].last;
+        printf("%d: first and last occurrence %d, %d; ceil index %d\n", queries[k],
+               found ? answers[k].first : -1, found ? answers[k].last - 1 : -1,
+               answers[k].first < n ? answers[k].first : -1);
+    }
+
+    free(nums);
+    free(queries);
+    free(answers);
+    return 0;
+}
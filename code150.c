@@ -0,0 +1,152 @@
+/*Search in a sorted array that is searched many times, using an Eytzinger (BFS order) index.
+The sorted array is re-laid so that the children of position k are at 2k and 2k+1, like a binary heap. A search then walks down the tree touching the first levels in the same few cache lines, and the node four levels below is prefetched while the current one is compared.
+Mode 1 builds the index for an entered array and searches for a number. Mode 2 benchmarks the index against plain binary search from 10^6 keys up to the entered size.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#if defined(__GNUC__)
+#define PREFETCH(p) __builtin_prefetch(p)
+#else
+#define PREFETCH(p)
+#endif
+
+typedef struct {
+    int *keys;   /* keys[1..n] in Eytzinger order, keys[0] unused */
+    int *rank;   /* rank[k] = index of keys[k] in the sorted array */
+    int n;
+} Eytzinger;
+
+/* Fills the tree by an in-order walk, which visits positions in sorted order. */
+int fill(Eytzinger *e, const int *sorted, int i, int k) {
+    if (k <= e->n) {
+        i = fill(e, sorted, i, 2 * k);
+        e->keys[k] = sorted[i];
+        e->rank[k] = i;
+        i++;
+        i = fill(e, sorted, i, 2 * k + 1);
+    }
+    return i;
+}
+
+Eytzinger buildIndex(const int *sorted, int n) {
+    Eytzinger e;
+    /* With 64-byte alignment the 16 nodes four levels below any node share one cache line. */
+    size_t bytes = (((size_t)n + 1) * sizeof(int) + 63) / 64 * 64;
+    e.keys = (int *)aligned_alloc(64, bytes);
+    e.rank = (int *)malloc(((size_t)n + 1) * sizeof(int));
+    e.n = n;
+    fill(&e, sorted, 0, 1);
+    return e;
+}
+
+/* Returns the Eytzinger position of the first key >= x, or 0 if every key is smaller. */
+int eytzingerLowerBound(const Eytzinger *e, int x) {
+    int k = 1;
+    while (k <= e->n) {
+        PREFETCH(e->keys + 16 * (size_t)k);
+        k = 2 * k + (e->keys[k] < x);
+    }
+    /* Undo the trailing right turns plus the final left turn. */
+    while (k & 1) {
+        k >>= 1;
+    }
+    return k >> 1;
+}
+
+/* Index of x in the sorted array, or -1. */
+int eytzingerSearch(const Eytzinger *e, int x) {
+    int k = eytzingerLowerBound(e, x);
+    return k != 0 && e->keys[k] == x ? e->rank[k] : -1;
+}
+
+/* The search from code65.c. */
+int binarySearch(const int *arr, int n, int y) {
+    int low = 0, high = n - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        if (arr[mid] == y) {
+            return mid;
+        } else if (arr[mid] < y) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return -1;
+}
+
+unsigned int nextRandom(unsigned int *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state;
+}
+
+void benchmark(int maxSize) {
+    const int queries = 2000000;
+    for (long long n = 1000000; n <= maxSize; n *= 10) {
+        int *sorted = (int *)malloc(n * sizeof(int));
+        if (sorted == NULL) {
+            printf("Not enough memory for %lld keys.\n", n);
+            return;
+        }
+        /* Even keys, so about half of the random queries miss. */
+        for (long long i = 0; i < n; i++) {
+            sorted[i] = (int)(2 * i);
+        }
+        Eytzinger e = buildIndex(sorted, (int)n);
+        unsigned int state = 12345;
+        long long check1 = 0, check2 = 0;
+
+        clock_t start = clock();
+        for (int q = 0; q < queries; q++) {
+            check1 += binarySearch(sorted, (int)n, (int)(nextRandom(&state) % (2 * n)));
+        }
+        double plain = 1e9 * (clock() - start) / CLOCKS_PER_SEC / queries;
+
+        state = 12345;
+        start = clock();
+        for (int q = 0; q < queries; q++) {
+            check2 += eytzingerSearch(&e, (int)(nextRandom(&state) % (2 * n)));
+        }
+        double eytz = 1e9 * (clock() - start) / CLOCKS_PER_SEC / queries;
+
+        printf("n = %10lld: binary search %6.1f ns, Eytzinger %6.1f ns %s\n", n, plain, eytz,
+               check1 == check2 ? "" : "(MISMATCH)");
+        free(sorted);
+        free(e.keys);
+        free(e.rank);
+    }
+}
+
+int main() {
+    int mode, n, y;
+    printf("Enter 1 to search an array, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter the largest array size to test (at most 1000000000): ");
+        scanf("%d", &n);
+        benchmark(n);
+        return 0;
+    }
+
+    printf("enter size of arrray:");
+    scanf("%d", &n);
+    int *arr = (int *)malloc((n + 1) * sizeof(int));
+    printf("enter sorted elements of array:");
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &arr[i]);
+    }
+    Eytzinger e = buildIndex(arr, n);
+    printf("enter the number to be searched:");
+    scanf("%d", &y);
+    int found = eytzingerSearch(&e, y);
+    if (found != -1) {
+        printf("%d found at index %d (position %d)\n", y, found, found + 1);
+    } else {
+        printf("%d is not in the array.\n", y);
+    }
+    free(arr);
+    free(e.keys);
+    free(e.rank);
+    return 0;
+}
@@ -0,0 +1,134 @@
+//Search in a sorted array with interpolation search and exponential search, and print how many array probes each method needs next to plain binary search, so the best method can be picked for a dataset.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+
+typedef struct {
+    int index;
+    int probes;
+} Result;
+
+/* The bisection from code65.c, counting probes. */
+Result binarySearch(const int *arr, int n, int y) {
+    Result r = {-1, 0};
+    int low = 0, high = n - 1;
+    while (low <= high) {
+        int mid = low + (high - low) / 2;
+        r.probes++;
+        if (arr[mid] == y) {
+            r.index = mid;
+            return r;
+        } else if (arr[mid] < y) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return r;
+}
+
+/* Interpolation search: guess the position from the values at both ends. On near-uniform
+   data this takes O(log log n) probes. If a guess fails to halve the range, the next step
+   is a plain bisection, so skewed or adversarial data still costs at most about 2 log n. */
+Result interpolationSearch(const int *arr, int n, int y) {
+    Result r = {-1, 0};
+    int low = 0, high = n - 1;
+    int bisectNext = 0;
+    while (low <= high && y >= arr[low] && y <= arr[high]) {
+        int size = high - low;
+        int pos;
+        if (bisectNext || arr[high] == arr[low]) {
+            pos = low + size / 2;
+        } else {
+            pos = low + (int)((double)(y - (long long)arr[low]) * size / ((long long)arr[high] - arr[low]));
+        }
+        r.probes++;
+        if (arr[pos] == y) {
+            r.index = pos;
+            return r;
+        } else if (arr[pos] < y) {
+            low = pos + 1;
+        } else {
+            high = pos - 1;
+        }
+        bisectNext = !bisectNext && high - low > size / 2;
+    }
+    return r;
+}
+
+/* Reads position i of a sorted stream whose length is not known in advance;
+   positions past the end read as INT_MAX. */
+int streamAt(const int *arr, int n, long long i) {
+    return i < n ? arr[i] : INT_MAX;
+}
+
+/* Exponential search: double the bound until it passes y, then bisect the last step.
+   It never needs the length, only the ability to read position i. */
+Result exponentialSearch(const int *arr, int n, int y) {
+    Result r = {-1, 0};
+    long long bound = 1;
+    r.probes++;
+    if (n > 0 && arr[0] == y) {
+        r.index = 0;
+        return r;
+    }
+    while (1) {
+        r.probes++;
+        if (streamAt(arr, n, bound) >= y) {
+            break;
+        }
+        bound *= 2;
+    }
+    long long low = bound / 2 + 1, high = bound;
+    while (low <= high) {
+        long long mid = low + (high - low) / 2;
+        int value = streamAt(arr, n, mid);
+        r.probes++;
+        if (value == y && mid < n) {
+            r.index = (int)mid;
+            return r;
+        } else if (value < y) {
+            low = mid + 1;
+        } else {
+            high = mid - 1;
+        }
+    }
+    return r;
+}
+
+int main() {
+    int n, q, y;
+    printf("enter size of array:");
+    scanf("%d", &n);
+    int *arr = (int *)malloc((n + 1) * sizeof(int));
+    printf("enter sorted elements of array:");
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &arr[i]);
+    }
+    printf("enter how many numbers to search:");
+    scanf("%d", &q);
+    long long totalBinary = 0, totalInterpolation = 0, totalExponential = 0;
+    for (int k = 0; k < q; k++) {
+        printf("enter the number to be searched:");
+        scanf("%d", &y);
+        Result b = binarySearch(arr, n, y);
+        Result i = interpolationSearch(arr, n, y);
+        Result e = exponentialSearch(arr, n, y);
+        if (b.index != -1) {
+            printf("%d found at index %d (position %d)\n", y, b.index, b.index + 1);
+        } else {
+            printf("%d is not in the array.\n", y);
+        }
+        printf("probes: binary %d, interpolation %d, exponential %d\n", b.probes, i.probes, e.probes);
+        totalBinary += b.probes;
+        totalInterpolation += i.probes;
+        totalExponential += e.probes;
+    }
+    if (q > 0) {
+        printf("average probes: binary %.2f, interpolation %.2f, exponential %.2f\n",
+               (double)totalBinary / q, (double)totalInterpolation / q, (double)totalExponential / q);
+    }
+    free(arr);
+    return 0;
+}
@@ -0,0 +1,333 @@
+/*Write a program that keeps a list of integers under millions of mixed insert and delete operations. Shifting every later element (as in code66.c, code67.c and code68.c) costs O(n) per operation, so store the list as a two-level B+tree instead: a root array of leaves, where every leaf is a contiguous array of LEAF_SIZE/2 to LEAF_SIZE elements, and a Fenwick tree over the leaf sizes that finds the leaf holding a position in O(log n). An operation shifts at most one or two leaves, and walking the leaves in order is a cache-friendly scan.
+Supported operations: insert at a position, delete at a position, and insert into sorted order. Mode 2 benchmarks the tree against the shifting array.*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define LEAF_SIZE 1024
+#define MIN_LEAF (LEAF_SIZE / 2)
+
+typedef struct {
+    int *data;
+    int size;
+} Leaf;
+
+typedef struct {
+    Leaf *leaves;
+    long long *fenwick;     /* 1-based Fenwick tree over leaves[].size */
+    int leafCount;
+    int leafCapacity;
+    long long size;
+} SortedList;
+
+void listInit(SortedList *list) {
+    list->leafCapacity = 4;
+    list->leafCount = 0;
+    list->leaves = (Leaf *)malloc(list->leafCapacity * sizeof(Leaf));
+    list->fenwick = (long long *)calloc(list->leafCapacity + 1, sizeof(long long));
+    list->size = 0;
+}
+
+void listFree(SortedList *list) {
+    for (int i = 0; i < list->leafCount; i++) {
+        free(list->leaves[i].data);
+    }
+    free(list->leaves);
+    free(list->fenwick);
+}
+
+/* Rebuilds the Fenwick tree in O(leafCount). Only a split or a merge changes the leaf
+   indices, and those happen once per about LEAF_SIZE / 2 operations. */
+void rebuildFenwick(SortedList *list) {
+    long long *tree = list->fenwick;
+    for (int i = 1; i <= list->leafCount; i++) {
+        tree[i] = list->leaves[i - 1].size;
+    }
+    for (int i = 1; i <= list->leafCount; i++) {
+        int parent = i + (i & -i);
+        if (parent <= list->leafCount) {
+            tree[parent] += tree[i];
+        }
+    }
+}
+
+/* Leaf i grew or shrank by delta. */
+void fenwickAdd(SortedList *list, int i, long long delta) {
+    for (i++; i <= list->leafCount; i += i & -i) {
+        list->fenwick[i] += delta;
+    }
+}
+
+/* Inserts an empty leaf at root slot index. */
+void insertLeaf(SortedList *list, int index) {
+    if (list->leafCount == list->leafCapacity) {
+        list->leafCapacity *= 2;
+        list->leaves = (Leaf *)realloc(list->leaves, list->leafCapacity * sizeof(Leaf));
+        list->fenwick = (long long *)realloc(list->fenwick, (list->leafCapacity + 1) * sizeof(long long));
+        memset(list->fenwick + list->leafCount + 1, 0, (list->leafCapacity - list->leafCount) * sizeof(long long));
+    }
+    memmove(&list->leaves[index + 1], &list->leaves[index], (list->leafCount - index) * sizeof(Leaf));
+    list->leaves[index].data = (int *)malloc(LEAF_SIZE * sizeof(int));
+    list->leaves[index].size = 0;
+    list->leafCount++;
+}
+
+void removeLeaf(SortedList *list, int index) {
+    free(list->leaves[index].data);
+    memmove(&list->leaves[index], &list->leaves[index + 1], (list->leafCount - index - 1) * sizeof(Leaf));
+    list->leafCount--;
+}
+
+/* Finds the leaf holding position pos and turns pos into an offset inside it, by walking
+   down the Fenwick tree in O(log leafCount). pos == size maps to the end of the last leaf. */
+int findLeaf(SortedList *list, long long *pos) {
+    if (*pos >= list->size) {
+        *pos -= list->size - list->leaves[list->leafCount - 1].size;
+        return list->leafCount - 1;
+    }
+    int step = 1;
+    while (step * 2 <= list->leafCount) {
+        step *= 2;
+    }
+    int i = 0;
+    for (; step > 0; step /= 2) {
+        if (i + step <= list->leafCount && list->fenwick[i + step] <= *pos) {
+            i += step;
+            *pos -= list->fenwick[i];
+        }
+    }
+    return i;
+}
+
+/* Inserts x at offset inside leaf i, splitting the leaf in half first if it is full. */
+void insertIntoLeaf(SortedList *list, int i, int offset, int x) {
+    if (list->leaves[i].size == LEAF_SIZE) {
+        insertLeaf(list, i + 1);
+        Leaf *left = &list->leaves[i], *right = &list->leaves[i + 1];
+        int half = LEAF_SIZE / 2;
+        memcpy(right->data, left->data + half, (LEAF_SIZE - half) * sizeof(int));
+        right->size = LEAF_SIZE - half;
+        left->size = half;
+        if (offset > half) {
+            i++;
+            offset -= half;
+        }
+        Leaf *leaf = &list->leaves[i];
+        memmove(leaf->data + offset + 1, leaf->data + offset, (leaf->size - offset) * sizeof(int));
+        leaf->data[offset] = x;
+        leaf->size++;
+        list->size++;
+        rebuildFenwick(list);
+        return;
+    }
+    Leaf *leaf = &list->leaves[i];
+    memmove(leaf->data + offset + 1, leaf->data + offset, (leaf->size - offset) * sizeof(int));
+    leaf->data[offset] = x;
+    leaf->size++;
+    list->size++;
+    fenwickAdd(list, i, 1);
+}
+
+/* Leaf i has dropped below MIN_LEAF: merge it with a neighbour if both fit in one leaf,
+   otherwise move elements over so both end up at least MIN_LEAF. */
+void rebalanceLeaf(SortedList *list, int i) {
+    if (list->leafCount == 1) {
+        return;
+    }
+    int l = i + 1 < list->leafCount ? i : i - 1;
+    Leaf *left = &list->leaves[l], *right = &list->leaves[l + 1];
+    if (left->size + right->size <= LEAF_SIZE) {
+        memcpy(left->data + left->size, right->data, right->size * sizeof(int));
+        left->size += right->size;
+        removeLeaf(list, l + 1);
+        rebuildFenwick(list);
+        return;
+    }
+    int total = left->size + right->size, target = total / 2;
+    if (left->size < target) {
+        int move = target - left->size;
+        memcpy(left->data + left->size, right->data, move * sizeof(int));
+        memmove(right->data, right->data + move, (right->size - move) * sizeof(int));
+        left->size += move;
+        right->size -= move;
+        fenwickAdd(list, l, move);
+        fenwickAdd(list, l + 1, -move);
+    } else {
+        int move = left->size - target;
+        memmove(right->data + move, right->data, right->size * sizeof(int));
+        memcpy(right->data, left->data + target, move * sizeof(int));
+        left->size -= move;
+        right->size += move;
+        fenwickAdd(list, l, -move);
+        fenwickAdd(list, l + 1, move);
+    }
+}
+
+int insertAt(SortedList *list, long long pos, int x) {
+    if (pos < 0 || pos > list->size) {
+        return 0;
+    }
+    if (list->leafCount == 0) {
+        insertLeaf(list, 0);
+        rebuildFenwick(list);
+    }
+    int i = findLeaf(list, &pos);
+    insertIntoLeaf(list, i, (int)pos, x);
+    return 1;
+}
+
+int deleteAt(SortedList *list, long long pos) {
+    if (pos < 0 || pos >= list->size) {
+        return 0;
+    }
+    int i = findLeaf(list, &pos);
+    Leaf *leaf = &list->leaves[i];
+    memmove(leaf->data + pos, leaf->data + pos + 1, (leaf->size - pos - 1) * sizeof(int));
+    leaf->size--;
+    list->size--;
+    fenwickAdd(list, i, -1);
+    if (leaf->size == 0) {
+        removeLeaf(list, i);
+        rebuildFenwick(list);
+    } else if (leaf->size < MIN_LEAF) {
+        rebalanceLeaf(list, i);
+    }
+    return 1;
+}
+
+/* Binary search over the last key of every leaf, then inside the chosen leaf. */
+void insertSorted(SortedList *list, int x) {
+    if (list->leafCount == 0) {
+        insertLeaf(list, 0);
+        rebuildFenwick(list);
+    }
+    int lo = 0, hi = list->leafCount - 1;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        Leaf *leaf = &list->leaves[mid];
+        if (leaf->data[leaf->size - 1] < x) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    Leaf *leaf = &list->leaves[lo];
+    int a = 0, b = leaf->size;
+    while (a < b) {
+        int mid = (a + b) / 2;
+        if (leaf->data[mid] < x) {
+            a = mid + 1;
+        } else {
+            b = mid;
+        }
+    }
+    insertIntoLeaf(list, lo, a, x);
+}
+
+void printList(SortedList *list) {
+    for (int i = 0; i < list->leafCount; i++) {
+        for (int j = 0; j < list->leaves[i].size; j++) {
+            printf("%d ", list->leaves[i].data[j]);
+        }
+    }
+    printf("\n");
+}
+
+unsigned int nextRandom(unsigned int *state) {
+    *state = *state * 1664525u + 1013904223u;
+    return *state >> 1;
+}
+
+/* Random positional inserts followed by random positional deletes. The shifting array is
+   O(ops^2), so it only runs up to 300000 operations. */
+void benchmark(int ops) {
+    unsigned int state = 7;
+    int *arr = (int *)malloc(ops * sizeof(int));
+    int n = 0;
+    int arrayOps = ops <= 300000 ? ops : 0;
+    clock_t start = clock();
+    for (int k = 0; k < arrayOps; k++) {
+        int pos = (int)(nextRandom(&state) % (n + 1));
+        for (int i = n; i > pos; i--) {
+            arr[i] = arr[i - 1];
+        }
+        arr[pos] = k;
+        n++;
+    }
+    for (int k = 0; k < arrayOps; k++) {
+        int pos = (int)(nextRandom(&state) % n);
+        for (int i = pos; i < n - 1; i++) {
+            arr[i] = arr[i + 1];
+        }
+        n--;
+    }
+    double shifting = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    SortedList list;
+    listInit(&list);
+    state = 7;
+    start = clock();
+    for (int k = 0; k < ops; k++) {
+        insertAt(&list, nextRandom(&state) % (list.size + 1), k);
+    }
+    for (int k = 0; k < ops; k++) {
+        deleteAt(&list, nextRandom(&state) % list.size);
+    }
+    double tree = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if (arrayOps > 0) {
+        printf("%d inserts + %d deletes: shifting array %.3f s, B+tree %.3f s\n", ops, ops, shifting, tree);
+    } else {
+        printf("%d inserts + %d deletes: B+tree %.3f s (shifting array skipped)\n", ops, ops, tree);
+    }
+    free(arr);
+    listFree(&list);
+}
+
+int main() {
+    int mode, n, q, op, x;
+    long long pos;
+    printf("Enter 1 to edit a list, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter number of operations of each kind: ");
+        scanf("%d", &n);
+        benchmark(n);
+        return 0;
+    }
+
+    SortedList list;
+    listInit(&list);
+    printf("Enter size of array: ");
+    scanf("%d", &n);
+    printf("Enter elements: ");
+    for (int i = 0; i < n; i++) {
+        scanf("%d", &x);
+        insertAt(&list, i, x);
+    }
+    printf("Enter number of operations: ");
+    scanf("%d", &q);
+    for (int k = 0; k < q; k++) {
+        printf("Enter 1 pos x (insert at position), 2 pos (delete at position) or 3 x (sorted insert): ");
+        scanf("%d", &op);
+        if (op == 1) {
+            scanf("%lld %d", &pos, &x);
+            if (!insertAt(&list, pos, x)) {
+                printf("Invalid position!\n");
+            }
+        } else if (op == 2) {
+            scanf("%lld", &pos);
+            if (!deleteAt(&list, pos)) {
+                printf("Invalid position!\n");
+            }
+        } else if (op == 3) {
+            scanf("%d", &x);
+            insertSorted(&list, x);
+        }
+    }
+    printf("Array after operations: ");
+    printList(&list);
+    listFree(&list);
+    return 0;
+}
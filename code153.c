@@ -0,0 +1,137 @@
+//Find the minimum, maximum, their indices and the second largest distinct element of an array in one single pass. The array is typed in (mode 1) or mapped from a binary file of 32-bit integers (mode 2); the chunks are reduced on separate threads (see chunks.h) and the chunk results are merged in order.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "chunks.h"
+
+typedef struct {
+    int min, max, second;
+    long long argmin, argmax;
+    int hasSecond;
+    long long count;
+} Stats;
+
+/* First index of value in arr, which is known to contain it. Groups of 16 are tested with
+   one vector compare before the group holding it is searched element by element. */
+long long firstIndexOf(const int *arr, long long len, int value) {
+    long long i = 0;
+    for (; i + 16 <= len; i += 16) {
+        int hit = 0;
+        for (int l = 0; l < 16; l++) {
+            hit |= arr[i + l] == value;
+        }
+        if (hit) {
+            break;
+        }
+    }
+    while (arr[i] != value) {
+        i++;
+    }
+    return i;
+}
+
+/* Reduces arr[0..len) whose first element sits at index offset of the whole input. Both
+   loops are branch-free so the compiler vectorizes them: the first keeps min and max with
+   selects, the second (on data still in cache) the largest value other than max, masking
+   copies of max to INT_MIN with bit operations (a select there is not vectorized). The
+   indices come from scanning for the first copy of min and max, so ties keep the earliest. */
+Stats reduceBlock(const int *arr, long long len, long long offset) {
+    Stats s;
+    int min = arr[0], max = arr[0];
+    for (long long i = 1; i < len; i++) {
+        min = arr[i] < min ? arr[i] : min;
+        max = arr[i] > max ? arr[i] : max;
+    }
+    int second = INT_MIN;
+    for (long long i = 0; i < len; i++) {
+        int keep = -(arr[i] != max);
+        int x = (arr[i] & keep) | (INT_MIN & ~keep);
+        second = x > second ? x : second;
+    }
+    int below = min < max;
+    s.min = min;
+    s.max = max;
+    s.argmin = offset + firstIndexOf(arr, len, min);
+    s.argmax = offset + firstIndexOf(arr, len, max);
+    s.second = below ? second : 0;
+    s.hasSecond = below;
+    s.count = len;
+    return s;
+}
+
+/* Offers value as a candidate for the largest two distinct values of s. */
+void offer(Stats *s, int value) {
+    if (value > s->max) {
+        s->second = s->max;
+        s->hasSecond = 1;
+        s->max = value;
+    } else if (value < s->max && (!s->hasSecond || value > s->second)) {
+        s->second = value;
+        s->hasSecond = 1;
+    }
+}
+
+/* Merges the result of a later block b into a; ties keep the earlier index. */
+Stats mergeStats(Stats a, Stats b) {
+    if (a.count == 0) {
+        return b;
+    }
+    if (b.min < a.min) {
+        a.min = b.min;
+        a.argmin = b.argmin;
+    }
+    if (b.max > a.max) {
+        a.argmax = b.argmax;
+    }
+    offer(&a, b.max);
+    if (b.hasSecond) {
+        offer(&a, b.second);
+    }
+    a.count += b.count;
+    return a;
+}
+
+typedef struct {
+    const int *arr;
+    Stats *parts;       /* one result per chunk */
+} ReduceJob;
+
+void reduceChunk(long long chunk, long long offset, long long len, void *ctx) {
+    ReduceJob *job = (ReduceJob *)ctx;
+    job->parts[chunk] = reduceBlock(job->arr + offset, len, offset);
+}
+
+int main() {
+    int mode;
+    long long n;
+    Stats total;
+    total.count = 0;
+    printf("Enter 1 to type the array, 2 to read a binary file: ");
+    scanf("%d", &mode);
+    int *arr = loadArray(mode, 0, "enter number of elements in array:", "enter elements of array:", &n);
+    if (arr == NULL) {
+        return 1;
+    }
+    ReduceJob job = {arr, (Stats *)malloc((chunkCount(n) + 1) * sizeof(Stats))};
+    forEachChunk(n, coreCount(), reduceChunk, &job);
+    /* Merging in chunk order keeps the earliest index on ties, as one sequential pass would. */
+    for (long long c = 0; c < chunkCount(n); c++) {
+        total = mergeStats(total, job.parts[c]);
+    }
+    free(job.parts);
+    releaseArray(mode, arr, n);
+
+    if (total.count == 0) {
+        printf("The array is empty.\n");
+        return 0;
+    }
+    printf("minimum = %d at index %lld\n", total.min, total.argmin);
+    printf("maximum = %d at index %lld\n", total.max, total.argmax);
+    if (total.hasSecond) {
+        printf("second largest = %d\n", total.second);
+    } else {
+        printf("second largest does not exist\n");
+    }
+    return 0;
+}
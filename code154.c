@@ -0,0 +1,105 @@
+//Find the sum, the count of even and odd numbers, the count of positive, negative and zero numbers, the minimum, the maximum, the mean and the variance of an array in one single pass. The array is typed in (mode 1) or mapped from a binary file of 32-bit integers (mode 2). The chunks are reduced on separate threads (see chunks.h) and the chunk results are merged, so the file is read only once.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "chunks.h"
+
+typedef struct {
+    long long count, sum;
+    long long even, positive, negative;
+    int min, max;
+    double mean, m2;    /* m2 = sum of squared differences from the mean */
+} Stats;
+
+/* The counting loop uses comparisons as 0/1 values instead of branches so it vectorizes;
+   the block is still in cache for the second loop that measures the spread. */
+Stats reduceBlock(const int *arr, long long len) {
+    Stats s;
+    long long sum = 0, even = 0, positive = 0, negative = 0;
+    int min = arr[0], max = arr[0];
+    for (long long i = 0; i < len; i++) {
+        int x = arr[i];
+        sum += x;
+        even += (x & 1) == 0;
+        positive += x > 0;
+        negative += x < 0;
+        min = x < min ? x : min;
+        max = x > max ? x : max;
+    }
+    s.count = len;
+    s.sum = sum;
+    s.even = even;
+    s.positive = positive;
+    s.negative = negative;
+    s.min = min;
+    s.max = max;
+    s.mean = (double)sum / len;
+    double m2 = 0;
+    for (long long i = 0; i < len; i++) {
+        double d = arr[i] - s.mean;
+        m2 += d * d;
+    }
+    s.m2 = m2;
+    return s;
+}
+
+/* Combines two partial results (Chan et al. for the variance). */
+Stats mergeStats(Stats a, Stats b) {
+    if (a.count == 0) {
+        return b;
+    }
+    Stats r;
+    r.count = a.count + b.count;
+    r.sum = a.sum + b.sum;
+    r.even = a.even + b.even;
+    r.positive = a.positive + b.positive;
+    r.negative = a.negative + b.negative;
+    r.min = a.min < b.min ? a.min : b.min;
+    r.max = a.max > b.max ? a.max : b.max;
+    double delta = b.mean - a.mean;
+    r.mean = a.mean + delta * b.count / r.count;
+    r.m2 = a.m2 + b.m2 + delta * delta * ((double)a.count * b.count / r.count);
+    return r;
+}
+
+typedef struct {
+    const int *arr;
+    Stats *parts;       /* one result per chunk */
+} ReduceJob;
+
+void reduceChunk(long long chunk, long long offset, long long len, void *ctx) {
+    ReduceJob *job = (ReduceJob *)ctx;
+    job->parts[chunk] = reduceBlock(job->arr + offset, len);
+}
+
+int main() {
+    int mode;
+    long long n;
+    Stats total;
+    total.count = 0;
+    printf("Enter 1 to type the array, 2 to read a binary file: ");
+    scanf("%d", &mode);
+    int *arr = loadArray(mode, 0, "enter number of elements in array:", "enter elements of array:", &n);
+    if (arr == NULL) {
+        return 1;
+    }
+    ReduceJob job = {arr, (Stats *)malloc((chunkCount(n) + 1) * sizeof(Stats))};
+    forEachChunk(n, coreCount(), reduceChunk, &job);
+    for (long long c = 0; c < chunkCount(n); c++) {
+        total = mergeStats(total, job.parts[c]);
+    }
+    free(job.parts);
+    releaseArray(mode, arr, n);
+
+    if (total.count == 0) {
+        printf("The array is empty.\n");
+        return 0;
+    }
+    printf("sum = %lld\n", total.sum);
+    printf("even = %lld, odd = %lld\n", total.even, total.count - total.even);
+    printf("positive = %lld, negative = %lld, zero = %lld\n", total.positive, total.negative,
+           total.count - total.positive - total.negative);
+    printf("min = %d, max = %d\n", total.min, total.max);
+    printf("mean = %.6f, variance = %.6f\n", total.mean, total.m2 / total.count);
+    return 0;
+}
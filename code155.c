@@ -0,0 +1,160 @@
+//Search for one or more numbers in an unsorted array using linear search. Either stop at the first match of every number, or collect the indices of all matches. The array is typed in (mode 1) or mapped from a binary file of 32-bit integers (mode 2), all numbers are searched in the same pass, and the chunks are searched on separate threads (see chunks.h).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include "chunks.h"
+
+#define LANES 16
+
+typedef struct {
+    int key;
+    long long *indices;
+    long long count;
+    long long capacity;
+} Matches;
+
+void addMatch(Matches *m, long long index) {
+    if (m->count == m->capacity) {
+        m->capacity = m->capacity ? m->capacity * 2 : 16;
+        m->indices = (long long *)realloc(m->indices, m->capacity * sizeof(long long));
+    }
+    m->indices[m->count++] = index;
+}
+
+/* Compares LANES elements at a time and packs the results into a bitmask, like a vector
+   compare followed by movemask; the mask is only decoded when some lane matched. */
+void scanBlock(const int *arr, long long len, long long offset, Matches *keys, int k, int firstOnly) {
+    long long i = 0;
+    for (; i + LANES <= len; i += LANES) {
+        for (int q = 0; q < k; q++) {
+            if (firstOnly && keys[q].count > 0) {
+                continue;
+            }
+            unsigned int mask = 0;
+            for (int lane = 0; lane < LANES; lane++) {
+                mask |= (unsigned int)(arr[i + lane] == keys[q].key) << lane;
+            }
+            while (mask != 0) {
+                int lane = 0;
+                while (((mask >> lane) & 1u) == 0) {
+                    lane++;
+                }
+                addMatch(&keys[q], offset + i + lane);
+                mask &= mask - 1;
+                if (firstOnly) {
+                    break;
+                }
+            }
+        }
+    }
+    for (; i < len; i++) {
+        for (int q = 0; q < k; q++) {
+            if (arr[i] == keys[q].key && !(firstOnly && keys[q].count > 0)) {
+                addMatch(&keys[q], offset + i);
+            }
+        }
+    }
+}
+
+typedef struct {
+    const int *arr;
+    const Matches *keys;
+    int k, firstOnly;
+    Matches *parts;         /* k results per chunk */
+    long long *firstChunk;  /* per key: earliest chunk known to hold it (firstOnly) */
+} SearchJob;
+
+/* Searches one chunk for the keys that no earlier chunk is known to hold; in stop-at-first
+   mode a later chunk has nothing to add for those. Matches go to the chunk's own results,
+   so threads never share a buffer. */
+void searchChunk(long long chunk, long long offset, long long len, void *ctx) {
+    SearchJob *job = (SearchJob *)ctx;
+    Matches *mine = job->parts + chunk * job->k;
+    Matches *pending = (Matches *)calloc(job->k, sizeof(Matches));
+    int *which = (int *)malloc(job->k * sizeof(int));
+    int count = 0;
+    for (int q = 0; q < job->k; q++) {
+        if (!job->firstOnly || __atomic_load_n(&job->firstChunk[q], __ATOMIC_RELAXED) > chunk) {
+            pending[count].key = job->keys[q].key;
+            which[count++] = q;
+        }
+    }
+    if (count > 0) {
+        scanBlock(job->arr + offset, len, offset, pending, count, job->firstOnly);
+    }
+    for (int p = 0; p < count; p++) {
+        int q = which[p];
+        mine[q] = pending[p];
+        if (job->firstOnly && pending[p].count > 0) {
+            long long seen = __atomic_load_n(&job->firstChunk[q], __ATOMIC_RELAXED);
+            while (chunk < seen && !__sync_bool_compare_and_swap(&job->firstChunk[q], seen, chunk)) {
+                seen = __atomic_load_n(&job->firstChunk[q], __ATOMIC_RELAXED);
+            }
+        }
+    }
+    free(pending);
+    free(which);
+}
+
+int main() {
+    int mode, k, firstOnly;
+    long long n;
+    printf("Enter 1 to type the array, 2 to read a binary file: ");
+    scanf("%d", &mode);
+    int *arr = loadArray(mode, 0, "enter no of elements of array:", "enter elements of array:", &n);
+    if (arr == NULL) {
+        return 1;
+    }
+    printf("enter how many numbers to search:");
+    scanf("%d", &k);
+    if (k < 1) {
+        printf("Nothing to search\n");
+        return 1;
+    }
+    Matches *keys = (Matches *)calloc(k, sizeof(Matches));
+    printf("enter the numbers to be searched:");
+    for (int q = 0; q < k; q++) {
+        scanf("%d", &keys[q].key);
+    }
+    printf("enter 1 to stop at the first match, 0 to find all matches:");
+    scanf("%d", &firstOnly);
+
+    long long chunks = chunkCount(n);
+    SearchJob job = {arr, keys, k, firstOnly, (Matches *)calloc((size_t)(chunks + 1) * k, sizeof(Matches)),
+                     (long long *)malloc(k * sizeof(long long))};
+    for (int q = 0; q < k; q++) {
+        job.firstChunk[q] = LLONG_MAX;
+    }
+    forEachChunk(n, coreCount(), searchChunk, &job);
+    /* Chunk results in chunk order give the indices in increasing order. */
+    for (long long c = 0; c < chunks; c++) {
+        for (int q = 0; q < k; q++) {
+            Matches *part = &job.parts[c * k + q];
+            for (long long m = 0; m < part->count && !(firstOnly && keys[q].count > 0); m++) {
+                addMatch(&keys[q], part->indices[m]);
+            }
+            free(part->indices);
+        }
+    }
+    free(job.parts);
+    free(job.firstChunk);
+    releaseArray(mode, arr, n);
+
+    for (int q = 0; q < k; q++) {
+        if (keys[q].count == 0) {
+            printf("%d is not found\n", keys[q].key);
+        } else if (firstOnly) {
+            printf("%d is first found at index %lld\n", keys[q].key, keys[q].indices[0]);
+        } else {
+            printf("%d is found %lld time(s) at index:", keys[q].key, keys[q].count);
+            for (long long m = 0; m < keys[q].count; m++) {
+                printf(" %lld", keys[q].indices[m]);
+            }
+            printf("\n");
+        }
+        free(keys[q].indices);
+    }
+    free(keys);
+    return 0;
+}
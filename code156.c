@@ -0,0 +1,99 @@
+//Reverse an array in place and rotate it left by k positions in place (triple reversal), either for an array that is typed in or directly inside a binary file of 32-bit integers mapped into memory. The element pairs that trade places are split into chunks that are swapped on separate threads (see chunks.h).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "chunks.h"
+
+#define LANES 8
+
+/* Swaps front[0..len) with back[0..len) reversed: front[i] trades places with back[len-1-i].
+   The main loop moves LANES elements from each side at once, reversing the lanes on the way;
+   written like this the compiler can turn it into vector loads, lane shuffles and stores. */
+void swapReversed(int *front, int *back, long long len) {
+    long long i = 0;
+    for (; i + LANES <= len; i += LANES) {
+        int *b = back + len - i - LANES;
+        int f[LANES], r[LANES];
+        for (int l = 0; l < LANES; l++) {
+            f[l] = front[i + l];
+            r[l] = b[l];
+        }
+        for (int l = 0; l < LANES; l++) {
+            front[i + l] = r[LANES - 1 - l];
+            b[l] = f[LANES - 1 - l];
+        }
+    }
+    for (; i < len; i++) {
+        int temp = front[i];
+        front[i] = back[len - 1 - i];
+        back[len - 1 - i] = temp;
+    }
+}
+
+typedef struct {
+    int *arr;
+    long long len;
+} ReverseJob;
+
+/* Chunk [offset, offset + count) of the first half trades places with the same-sized range
+   mirrored at the end; the ranges of different chunks never overlap. */
+void reverseChunk(long long chunk, long long offset, long long count, void *ctx) {
+    ReverseJob *job = (ReverseJob *)ctx;
+    (void)chunk;
+    swapReversed(job->arr + offset, job->arr + job->len - offset - count, count);
+}
+
+/* Reverses arr[0..len) in place on up to threads threads. */
+void reverse(int *arr, long long len, int threads) {
+    ReverseJob job = {arr, len};
+    forEachChunk(len / 2, threads, reverseChunk, &job);
+}
+
+/* Rotates left by k: reversing both parts and then the whole array moves every element once per pass. */
+void rotateLeft(int *arr, long long len, long long k, int threads) {
+    if (len == 0) {
+        return;
+    }
+    k %= len;
+    reverse(arr, k, threads);
+    reverse(arr + k, len - k, threads);
+    reverse(arr, len, threads);
+}
+
+int main() {
+    int mode, op;
+    long long k, n;
+    printf("Enter 1 to type the array, 2 to work on a binary file: ");
+    scanf("%d", &mode);
+    printf("Enter 1 to reverse, 2 to rotate left by k: ");
+    scanf("%d", &op);
+    k = 0;
+    if (op == 2) {
+        printf("Enter k: ");
+        scanf("%lld", &k);
+        if (k < 0) {
+            printf("k must not be negative\n");
+            return 1;
+        }
+    }
+
+    int *array = loadArray(mode, 1, "enter size of array:", "enter elements of array:", &n);
+    if (array == NULL) {
+        return 1;
+    }
+    if (op == 2) {
+        rotateLeft(array, n, k, coreCount());
+    } else {
+        reverse(array, n, coreCount());
+    }
+    if (mode == 2) {
+        printf("%s done on %lld integers.\n", op == 2 ? "Rotation" : "Reversal", n);
+    } else {
+        for (long long i = 0; i < n; i++) {
+            printf("%d ", array[i]);
+        }
+        printf("\n");
+    }
+    releaseArray(mode, array, n);
+    return 0;
+}
@@ -0,0 +1,240 @@
+//Multiply an m x k matrix by a k x n matrix with a cache-blocked algorithm. The operands are cut into blocks that fit in the caches, every block is packed into contiguous panels, and a small register-blocked kernel multiplies the panels. Versions exist for int (with 64-bit results), float and double. The MC-row blocks of A are shared out between threads (link with -pthread). Mode 2 prints GFLOP/s against the plain triple loop for sizes from 64 to 4096, on one thread and on one thread per core.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define MR 4      /* rows of C computed by one kernel call */
+#define NR 8      /* columns of C computed by one kernel call */
+#define KC 256    /* depth of a packed panel */
+#define MC 128    /* rows of A packed at once (MC x KC stays in L2) */
+#define NC 2048   /* columns of B packed at once (KC x NC stays in L3) */
+
+/* DEFINE_GEMM(name, T, ACC) defines name(m, n, k, A, B, C, threads) computing C = A * B for
+   row-major A (m x k, type T), B (k x n, type T) and C (m x n, type ACC) on up to threads threads. */
+#define DEFINE_GEMM(name, T, ACC)                                                            \
+/* Packs rows [0, mc) x depth [0, kc) of A into MR-row panels, zero-padding the last one. */  \
+static void name##PackA(int mc, int kc, const T *A, int lda, ACC *Ap) {                    \
+    for (int i = 0; i < mc; i += MR) {                                                       \
+        for (int p = 0; p < kc; p++) {                                                       \
+            for (int r = 0; r < MR; r++) {                                                   \
+                *Ap++ = i + r < mc ? (ACC)A[(size_t)(i + r) * lda + p] : 0;                  \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+}                                                                                            \
+/* Packs depth [0, kc) x columns [0, nc) of B into NR-column panels. */                       \
+static void name##PackB(int kc, int nc, const T *B, int ldb, ACC *Bp) {                    \
+    for (int j = 0; j < nc; j += NR) {                                                       \
+        for (int p = 0; p < kc; p++) {                                                       \
+            for (int c = 0; c < NR; c++) {                                                   \
+                *Bp++ = j + c < nc ? (ACC)B[(size_t)p * ldb + j + c] : 0;                    \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+}                                                                                            \
+/* MR x NR block of C += panel of A * panel of B. The accumulators stay in registers and   \
+   the inner loop over c is a fixed-width multiply-add the compiler vectorizes. */            \
+static void name##Kernel(int kc, const ACC *Ap, const ACC *Bp, ACC *C, int ldc,            \
+                         int mr, int nr) {                                                   \
+    ACC acc[MR][NR];                                                                         \
+    memset(acc, 0, sizeof(acc));                                                             \
+    for (int p = 0; p < kc; p++) {                                                           \
+        for (int r = 0; r < MR; r++) {                                                       \
+            ACC a = Ap[p * MR + r];                                                          \
+            for (int c = 0; c < NR; c++) {                                                   \
+                acc[r][c] += a * Bp[p * NR + c];                                             \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+    for (int r = 0; r < mr; r++) {                                                           \
+        for (int c = 0; c < nr; c++) {                                                       \
+            C[(size_t)r * ldc + c] += acc[r][c];                                             \
+        }                                                                                    \
+    }                                                                                        \
+}                                                                                            \
+/* One thread's view of a packed KC x NC panel of B. Threads take MC-row blocks of A from    \
+   next, so each writes its own rows of C and packs A into its own buffer Ap. */             \
+typedef struct {                                                                             \
+    const T *A;                                                                              \
+    const ACC *Bp;                                                                           \
+    ACC *C, *Ap;                                                                             \
+    int m, n, k, jc, nc, pc, kc;                                                             \
+    int *next;                                                                               \
+} name##Task;                                                                                \
+static void *name##Worker(void *arg) {                                                       \
+    name##Task *t = (name##Task *)arg;                                                       \
+    for (;;) {                                                                               \
+        int ic = __sync_fetch_and_add(t->next, MC);                                          \
+        if (ic >= t->m) {                                                                    \
+            return NULL;                                                                     \
+        }                                                                                    \
+        int mc = t->m - ic < MC ? t->m - ic : MC;                                            \
+        name##PackA(mc, t->kc, t->A + (size_t)ic * t->k + t->pc, t->k, t->Ap);               \
+        for (int jr = 0; jr < t->nc; jr += NR) {                                             \
+            for (int ir = 0; ir < mc; ir += MR) {                                            \
+                name##Kernel(t->kc, t->Ap + (size_t)ir * t->kc, t->Bp + (size_t)jr * t->kc,  \
+                             t->C + (size_t)(ic + ir) * t->n + t->jc + jr, t->n,             \
+                             mc - ir < MR ? mc - ir : MR,                                    \
+                             t->nc - jr < NR ? t->nc - jr : NR);                             \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+}                                                                                            \
+void name(int m, int n, int k, const T *A, const T *B, ACC *C, int threads) {                \
+    int blocks = (m + MC - 1) / MC;                                                          \
+    threads = threads < blocks ? threads : blocks;                                           \
+    threads = threads < 1 ? 1 : threads;                                                     \
+    ACC *Ap = (ACC *)malloc((size_t)threads * (MC + MR) * KC * sizeof(ACC));                 \
+    ACC *Bp = (ACC *)malloc((size_t)(NC + NR) * KC * sizeof(ACC));                           \
+    name##Task *tasks = (name##Task *)malloc(threads * sizeof(name##Task));                  \
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));                       \
+    memset(C, 0, (size_t)m * n * sizeof(ACC));                                               \
+    for (int jc = 0; jc < n; jc += NC) {                                                     \
+        int nc = n - jc < NC ? n - jc : NC;                                                  \
+        for (int pc = 0; pc < k; pc += KC) {                                                 \
+            int kc = k - pc < KC ? k - pc : KC;                                              \
+            int next = 0;                                                                    \
+            name##PackB(kc, nc, B + (size_t)pc * n + jc, n, Bp);                             \
+            for (int t = 0; t < threads; t++) {                                              \
+                name##Task task = {A, Bp, C, Ap + (size_t)t * (MC + MR) * KC,                \
+                                   m, n, k, jc, nc, pc, kc, &next};                          \
+                tasks[t] = task;                                                             \
+            }                                                                                \
+            /* The calling thread takes a share too; all blocks of this panel are done       \
+               before the next one overwrites Bp. */                                         \
+            for (int t = 1; t < threads; t++) {                                              \
+                pthread_create(&ids[t], NULL, name##Worker, &tasks[t]);                      \
+            }                                                                                \
+            name##Worker(&tasks[0]);                                                         \
+            for (int t = 1; t < threads; t++) {                                              \
+                pthread_join(ids[t], NULL);                                                  \
+            }                                                                                \
+        }                                                                                    \
+    }                                                                                        \
+    free(Ap);                                                                                \
+    free(Bp);                                                                                \
+    free(tasks);                                                                             \
+    free(ids);                                                                               \
+}
+
+DEFINE_GEMM(gemmInt, int, long long)
+DEFINE_GEMM(gemmFloat, float, float)
+DEFINE_GEMM(gemmDouble, double, double)
+
+/* The plain i-j-p triple loop, used as the baseline. */
+void naiveDouble(int m, int n, int k, const double *A, const double *B, double *C) {
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            double sum = 0;
+            for (int p = 0; p < k; p++) {
+                sum += A[(size_t)i * k + p] * B[(size_t)p * n + j];
+            }
+            C[(size_t)i * n + j] = sum;
+        }
+    }
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+/* Wall-clock time; clock() would add up the CPU time of all threads. */
+double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+void benchmark(void) {
+    int cores = coreCount();
+    printf("GFLOP/s, blocked versions on 1 thread and on %d threads\n", cores);
+    printf("%6s %12s %12s %12s %12s %12s\n", "size", "naive dbl", "dbl x1", "dbl xN", "flt xN", "int xN");
+    for (int s = 64; s <= 4096; s *= 2) {
+        size_t count = (size_t)s * s;
+        double *A = (double *)malloc(count * sizeof(double));
+        double *B = (double *)malloc(count * sizeof(double));
+        double *C = (double *)malloc(count * sizeof(double));
+        double *D = (double *)malloc(count * sizeof(double));
+        float *Af = (float *)malloc(count * sizeof(float));
+        float *Bf = (float *)malloc(count * sizeof(float));
+        float *Cf = (float *)malloc(count * sizeof(float));
+        int *Ai = (int *)malloc(count * sizeof(int));
+        int *Bi = (int *)malloc(count * sizeof(int));
+        long long *Ci = (long long *)malloc(count * sizeof(long long));
+        for (size_t i = 0; i < count; i++) {
+            Ai[i] = rand() % 100;
+            Bi[i] = rand() % 100;
+            A[i] = Af[i] = (float)Ai[i];
+            B[i] = Bf[i] = (float)Bi[i];
+        }
+        double flops = 2.0 * s * s * s, start;
+        char naive[16] = "skipped";
+        /* The triple loop needs minutes above 1024. */
+        if (s <= 1024) {
+            start = seconds();
+            naiveDouble(s, s, s, A, B, D);
+            sprintf(naive, "%.2f", flops / (seconds() - start) / 1e9);
+        }
+        start = seconds();
+        gemmDouble(s, s, s, A, B, C, 1);
+        double blocked = flops / (seconds() - start) / 1e9;
+        int ok = s > 1024 || memcmp(C, D, count * sizeof(double)) == 0;
+        start = seconds();
+        gemmDouble(s, s, s, A, B, C, cores);
+        double threaded = flops / (seconds() - start) / 1e9;
+        ok = ok && (s > 1024 || memcmp(C, D, count * sizeof(double)) == 0);
+        start = seconds();
+        gemmFloat(s, s, s, Af, Bf, Cf, cores);
+        double blockedFloat = flops / (seconds() - start) / 1e9;
+        start = seconds();
+        gemmInt(s, s, s, Ai, Bi, Ci, cores);
+        double blockedInt = flops / (seconds() - start) / 1e9;
+        printf("%6d %12s %12.2f %12.2f %12.2f %12.2f %s\n", s, naive, blocked, threaded, blockedFloat,
+               blockedInt, ok ? "" : "(MISMATCH)");
+        free(A); free(B); free(C); free(D);
+        free(Af); free(Bf); free(Cf);
+        free(Ai); free(Bi); free(Ci);
+    }
+}
+
+int main() {
+    int mode, m, k, n;
+    printf("Enter 1 to multiply two matrices, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        benchmark();
+        return 0;
+    }
+    printf("Enter rows and columns of first matrix: ");
+    scanf("%d%d", &m, &k);
+    printf("Enter number of columns of second matrix: ");
+    scanf("%d", &n);
+    int *a = (int *)malloc((size_t)m * k * sizeof(int) + 1);
+    int *b = (int *)malloc((size_t)k * n * sizeof(int) + 1);
+    long long *mul = (long long *)malloc((size_t)m * n * sizeof(long long) + 1);
+    printf("Enter elements of first matrix:\n");
+    for (int i = 0; i < m * k; i++) {
+        scanf("%d", &a[i]);
+    }
+    printf("Enter elements of second matrix:\n");
+    for (int i = 0; i < k * n; i++) {
+        scanf("%d", &b[i]);
+    }
+    gemmInt(m, n, k, a, b, mul, coreCount());
+    printf("Resultant Matrix:\n");
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            printf("%lld ", mul[(size_t)i * n + j]);
+        }
+        printf("\n");
+    }
+    free(a);
+    free(b);
+    free(mul);
+    return 0;
+}
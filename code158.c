@@ -0,0 +1,236 @@
+//Multiply two large n x n matrices of doubles with the Strassen-Winograd algorithm (7 half-size products instead of 8). The recursion stops at a crossover size and uses a cache-blocked multiply there. All temporary matrices come from one workspace arena allocated up front, so the recursion itself allocates nothing. The result is compared with the classical product against the known Strassen error bound.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+
+#define TILE 64
+
+/* Bump allocator: each recursion level takes its temporaries and gives them back on return. */
+typedef struct {
+    double *base;
+    size_t used;
+    size_t capacity;
+} Arena;
+
+/* Returns NULL when the workspace is used up. */
+double *arenaTake(Arena *arena, size_t count) {
+    if (count > arena->capacity - arena->used) {
+        return NULL;
+    }
+    double *p = arena->base + arena->used;
+    arena->used += count;
+    return p;
+}
+
+/* C = A * B for n x n blocks with row strides lda, ldb, ldc, tiled so that a TILE x TILE
+   block of B stays in cache while the i-p-j inner loops stream over it. */
+void blockedMultiply(int n, const double *A, int lda, const double *B, int ldb, double *C, int ldc) {
+    for (int i = 0; i < n; i++) {
+        memset(C + (size_t)i * ldc, 0, n * sizeof(double));
+    }
+    for (int pp = 0; pp < n; pp += TILE) {
+        int pEnd = pp + TILE < n ? pp + TILE : n;
+        for (int jj = 0; jj < n; jj += TILE) {
+            int jEnd = jj + TILE < n ? jj + TILE : n;
+            for (int i = 0; i < n; i++) {
+                double *c = C + (size_t)i * ldc;
+                for (int p = pp; p < pEnd; p++) {
+                    double a = A[(size_t)i * lda + p];
+                    const double *b = B + (size_t)p * ldb;
+                    for (int j = jj; j < jEnd; j++) {
+                        c[j] += a * b[j];
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* Z = X + sign * Y on h x h blocks. */
+void addBlocks(int h, const double *X, int ldx, const double *Y, int ldy, double sign, double *Z, int ldz) {
+    for (int i = 0; i < h; i++) {
+        for (int j = 0; j < h; j++) {
+            Z[(size_t)i * ldz + j] = X[(size_t)i * ldx + j] + sign * Y[(size_t)i * ldy + j];
+        }
+    }
+}
+
+/* C = A * B with Winograd's variant of Strassen: 7 half-size products per level. The sums
+   S1..S4 and T1..T4 and the partial results U2, U3 share four temporaries from the arena. */
+void strassen(int n, const double *A, int lda, const double *B, int ldb, double *C, int ldc,
+              int crossover, Arena *arena) {
+    if (n <= crossover || n % 2 != 0) {
+        blockedMultiply(n, A, lda, B, ldb, C, ldc);
+        return;
+    }
+    int h = n / 2;
+    size_t q = (size_t)h * h;
+    size_t mark = arena->used;
+    const double *A11 = A, *A12 = A + h, *A21 = A + (size_t)h * lda, *A22 = A21 + h;
+    const double *B11 = B, *B12 = B + h, *B21 = B + (size_t)h * ldb, *B22 = B21 + h;
+    double *C11 = C, *C12 = C + h, *C21 = C + (size_t)h * ldc, *C22 = C21 + h;
+    double *S = arenaTake(arena, q), *T = arenaTake(arena, q);
+    double *P = arenaTake(arena, q), *U = arenaTake(arena, q);
+    /* workspaceSize() covers every level, so this only happens with a smaller arena. */
+    if (S == NULL || T == NULL || P == NULL || U == NULL) {
+        arena->used = mark;
+        blockedMultiply(n, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    /* P1 = A11 * B11 is kept in U; P2 = A12 * B21 gives C11 = P1 + P2. */
+    strassen(h, A11, lda, B11, ldb, U, h, crossover, arena);
+    strassen(h, A12, lda, B21, ldb, P, h, crossover, arena);
+    addBlocks(h, U, h, P, h, 1, C11, ldc);
+
+    /* S1 = A21 + A22, T1 = B12 - B11, P5 = S1 * T1 -> C22 for now, C12 = P5. */
+    addBlocks(h, A21, lda, A22, lda, 1, S, h);
+    addBlocks(h, B12, ldb, B11, ldb, -1, T, h);
+    strassen(h, S, h, T, h, C22, ldc, crossover, arena);
+    for (int i = 0; i < h; i++) {
+        memcpy(C12 + (size_t)i * ldc, C22 + (size_t)i * ldc, h * sizeof(double));
+    }
+
+    /* S2 = S1 - A11, T2 = B22 - T1, P6 = S2 * T2; U2 = P1 + P6 kept in U. */
+    addBlocks(h, S, h, A11, lda, -1, S, h);
+    addBlocks(h, B22, ldb, T, h, -1, T, h);
+    strassen(h, S, h, T, h, P, h, crossover, arena);
+    addBlocks(h, U, h, P, h, 1, U, h);
+
+    /* C12 = U2 + P5 + P3 with S4 = A12 - S2, P3 = S4 * B22. */
+    addBlocks(h, C12, ldc, U, h, 1, C12, ldc);
+    addBlocks(h, A12, lda, S, h, -1, S, h);
+    strassen(h, S, h, B22, ldb, P, h, crossover, arena);
+    addBlocks(h, C12, ldc, P, h, 1, C12, ldc);
+
+    /* U3 = U2 + P7 with S3 = A11 - A21, T3 = B22 - B12. */
+    addBlocks(h, A11, lda, A21, lda, -1, S, h);
+    addBlocks(h, B22, ldb, B12, ldb, -1, T, h);
+    strassen(h, S, h, T, h, P, h, crossover, arena);
+    addBlocks(h, U, h, P, h, 1, U, h);
+
+    /* C22 = U3 + P5 (P5 is still in C22); C21 = U3 - P4 with T4 = T2 - B21, P4 = A22 * T4. */
+    addBlocks(h, C22, ldc, U, h, 1, C22, ldc);
+    addBlocks(h, B12, ldb, B11, ldb, -1, T, h);
+    addBlocks(h, B22, ldb, T, h, -1, T, h);
+    addBlocks(h, T, h, B21, ldb, -1, T, h);
+    strassen(h, A22, lda, T, h, P, h, crossover, arena);
+    addBlocks(h, U, h, P, h, -1, C21, ldc);
+
+    arena->used = mark;
+}
+
+/* Four h x h temporaries per level: 4 * (n/2)^2 * (1 + 1/4 + 1/16 + ...) < 4/3 * n^2. */
+size_t workspaceSize(int n) {
+    return (size_t)n * n * 4 / 3 + 64;
+}
+
+double seconds(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+double maxAbs(const double *M, size_t count) {
+    double m = 0;
+    for (size_t i = 0; i < count; i++) {
+        m = fabs(M[i]) > m ? fabs(M[i]) : m;
+    }
+    return m;
+}
+
+/* Finds the smallest power-of-two size where one Strassen level beats the blocked multiply. */
+int tuneCrossover(void) {
+    for (int s = 64; s <= 2048; s *= 2) {
+        size_t count = (size_t)s * s;
+        double *A = (double *)malloc(count * sizeof(double));
+        double *B = (double *)malloc(count * sizeof(double));
+        double *C = (double *)malloc(count * sizeof(double));
+        Arena arena = {(double *)malloc(workspaceSize(s) * sizeof(double)), 0, workspaceSize(s)};
+        for (size_t i = 0; i < count; i++) {
+            A[i] = (double)rand() / RAND_MAX;
+            B[i] = (double)rand() / RAND_MAX;
+        }
+        /* Repeat small sizes so every measurement covers roughly the same amount of work. */
+        int reps = 1 + (int)((1LL << 30) / ((long long)s * s * s));
+        double start = seconds();
+        for (int r = 0; r < reps; r++) {
+            blockedMultiply(s, A, s, B, s, C, s);
+        }
+        double blocked = (seconds() - start) / reps;
+        start = seconds();
+        for (int r = 0; r < reps; r++) {
+            strassen(s, A, s, B, s, C, s, s / 2, &arena);
+        }
+        double oneLevel = (seconds() - start) / reps;
+        printf("n = %4d: blocked %.4f s, one Strassen level %.4f s\n", s, blocked, oneLevel);
+        free(A);
+        free(B);
+        free(C);
+        free(arena.base);
+        if (oneLevel < 0.95 * blocked) {
+            return s / 2;
+        }
+    }
+    return 1024;
+}
+
+int main() {
+    int n, crossover;
+    printf("Enter the matrix size n: ");
+    scanf("%d", &n);
+    printf("Enter the crossover size (0 to tune it on this machine): ");
+    scanf("%d", &crossover);
+    if (n < 1) {
+        printf("Invalid size\n");
+        return 1;
+    }
+    if (crossover <= 0) {
+        crossover = tuneCrossover();
+    }
+    printf("Using crossover %d\n", crossover);
+
+    size_t count = (size_t)n * n;
+    double *A = (double *)malloc(count * sizeof(double));
+    double *B = (double *)malloc(count * sizeof(double));
+    double *C = (double *)malloc(count * sizeof(double));
+    double *D = (double *)malloc(count * sizeof(double));
+    Arena arena = {(double *)malloc(workspaceSize(n) * sizeof(double)), 0, workspaceSize(n)};
+    srand(1);
+    for (size_t i = 0; i < count; i++) {
+        A[i] = 2.0 * rand() / RAND_MAX - 1;
+        B[i] = 2.0 * rand() / RAND_MAX - 1;
+    }
+
+    double start = seconds();
+    strassen(n, A, n, B, n, C, n, crossover, &arena);
+    double fast = seconds() - start;
+    start = seconds();
+    blockedMultiply(n, A, n, B, n, D, n);
+    double classic = seconds() - start;
+    printf("Strassen-Winograd: %.3f s, blocked: %.3f s\n", fast, classic);
+
+    /* Higham's bound for the Winograd variant with recursion stopping at n0 (max-norm form):
+       |C - C'| <= [(n/n0)^log2(18) * (n0^2 + 6 n0) - 6n] * u * |A| * |B|. */
+    double n0 = n;
+    while (n0 > crossover && fmod(n0, 2) == 0) {
+        n0 /= 2;
+    }
+    double bound = (pow(n / n0, log2(18.0)) * (n0 * n0 + 6 * n0) - 6.0 * n) * DBL_EPSILON / 2
+                   * maxAbs(A, count) * maxAbs(B, count);
+    for (size_t i = 0; i < count; i++) {
+        D[i] -= C[i];
+    }
+    double error = maxAbs(D, count);
+    printf("max difference from classical product: %.3e (bound %.3e) %s\n", error, bound,
+           error <= bound ? "OK" : "EXCEEDED");
+
+    free(A);
+    free(B);
+    free(C);
+    free(D);
+    free(arena.base);
+    return 0;
+}
@@ -0,0 +1,184 @@
+//Find the transpose of a matrix of any size. Out of place, the matrix is split recursively (cache-oblivious) until the pieces fit in cache, and each piece is transposed in 8x8 tiles. In place, a square matrix swaps tiles across the diagonal and a rectangular matrix moves its elements along the cycles of the transpose permutation. Mode 2 measures the bandwidth of each method for an n x n matrix (16384 for 16K x 16K).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define TILE 8
+#define LEAF 64
+
+/* Transposes one TILE x TILE tile through a local block; the compiler keeps it in registers. */
+void transposeTile(const int *src, int lds, int *dst, int ldd) {
+    int block[TILE][TILE];
+    for (int i = 0; i < TILE; i++) {
+        for (int j = 0; j < TILE; j++) {
+            block[j][i] = src[(size_t)i * lds + j];
+        }
+    }
+    for (int j = 0; j < TILE; j++) {
+        memcpy(dst + (size_t)j * ldd, block[j], TILE * sizeof(int));
+    }
+}
+
+/* dst (cols x rows) = transpose of src (rows x cols). */
+void transposeLeaf(const int *src, int rows, int cols, int lds, int *dst, int ldd) {
+    int i = 0;
+    for (; i + TILE <= rows; i += TILE) {
+        int j = 0;
+        for (; j + TILE <= cols; j += TILE) {
+            transposeTile(src + (size_t)i * lds + j, lds, dst + (size_t)j * ldd + i, ldd);
+        }
+        for (; j < cols; j++) {
+            for (int r = i; r < i + TILE; r++) {
+                dst[(size_t)j * ldd + r] = src[(size_t)r * lds + j];
+            }
+        }
+    }
+    for (; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            dst[(size_t)j * ldd + i] = src[(size_t)i * lds + j];
+        }
+    }
+}
+
+/* Halves the longer side until the piece fits in cache, whatever the cache size is. */
+void transposeRecursive(const int *src, int rows, int cols, int lds, int *dst, int ldd) {
+    if (rows <= LEAF && cols <= LEAF) {
+        transposeLeaf(src, rows, cols, lds, dst, ldd);
+    } else if (rows >= cols) {
+        int half = rows / 2;
+        transposeRecursive(src, half, cols, lds, dst, ldd);
+        transposeRecursive(src + (size_t)half * lds, rows - half, cols, lds, dst + half, ldd);
+    } else {
+        int half = cols / 2;
+        transposeRecursive(src, rows, half, lds, dst, ldd);
+        transposeRecursive(src + half, rows, cols - half, lds, dst + (size_t)half * ldd, ldd);
+    }
+}
+
+/* The element-by-element loop from code73.c. */
+void transposeNaive(const int *src, int rows, int cols, int *dst) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            dst[(size_t)j * rows + i] = src[(size_t)i * cols + j];
+        }
+    }
+}
+
+/* In place for n x n: tile (I, J) is swapped with the transpose of tile (J, I). */
+void transposeSquareInPlace(int *a, int n) {
+    int temp[LEAF * LEAF];
+    for (int bi = 0; bi < n; bi += LEAF) {
+        int hi = n - bi < LEAF ? n - bi : LEAF;
+        /* Diagonal tile: swap across its own diagonal. */
+        for (int i = bi; i < bi + hi; i++) {
+            for (int j = i + 1; j < bi + hi; j++) {
+                int t = a[(size_t)i * n + j];
+                a[(size_t)i * n + j] = a[(size_t)j * n + i];
+                a[(size_t)j * n + i] = t;
+            }
+        }
+        for (int bj = bi + LEAF; bj < n; bj += LEAF) {
+            int wj = n - bj < LEAF ? n - bj : LEAF;
+            int *upper = a + (size_t)bi * n + bj;   /* hi x wj */
+            int *lower = a + (size_t)bj * n + bi;   /* wj x hi */
+            transposeLeaf(upper, hi, wj, n, temp, hi);
+            transposeLeaf(lower, wj, hi, n, upper, n);
+            for (int r = 0; r < wj; r++) {
+                memcpy(lower + (size_t)r * n, temp + (size_t)r * hi, hi * sizeof(int));
+            }
+        }
+    }
+}
+
+/* In place for rows x cols: the element at position p moves to p * rows mod (N - 1).
+   Each cycle of that permutation is followed once; a bitset marks the moved positions. */
+void transposeRectInPlace(int *a, int rows, int cols) {
+    size_t total = (size_t)rows * cols;
+    if (total < 3) {
+        return;
+    }
+    unsigned char *moved = (unsigned char *)calloc(total / 8 + 1, 1);
+    for (size_t start = 1; start < total - 1; start++) {
+        if (moved[start / 8] & (1 << (start % 8))) {
+            continue;
+        }
+        size_t p = start;
+        int carry = a[p];
+        do {
+            size_t next = p * rows % (total - 1);
+            int t = a[next];
+            a[next] = carry;
+            carry = t;
+            moved[next / 8] |= (unsigned char)(1 << (next % 8));
+            p = next;
+        } while (p != start);
+    }
+    free(moved);
+}
+
+double seconds(void) {
+    return (double)clock() / CLOCKS_PER_SEC;
+}
+
+void benchmark(int n) {
+    size_t count = (size_t)n * n;
+    int *a = (int *)malloc(count * sizeof(int));
+    int *b = (int *)malloc(count * sizeof(int));
+    if (a == NULL || b == NULL) {
+        printf("Not enough memory for %d x %d.\n", n, n);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        a[i] = (int)i;
+    }
+    memset(b, 0, count * sizeof(int));
+    /* Every method reads and writes the whole matrix once. */
+    double bytes = 2.0 * count * sizeof(int);
+    double start = seconds();
+    transposeNaive(a, n, n, b);
+    printf("naive out of place:     %6.2f GB/s\n", bytes / (seconds() - start) / 1e9);
+    start = seconds();
+    transposeRecursive(a, n, n, n, b, n);
+    printf("recursive out of place: %6.2f GB/s\n", bytes / (seconds() - start) / 1e9);
+    start = seconds();
+    transposeSquareInPlace(a, n);
+    printf("tiled in place:         %6.2f GB/s %s\n", bytes / (seconds() - start) / 1e9,
+           memcmp(a, b, count * sizeof(int)) == 0 ? "" : "(MISMATCH)");
+    free(a);
+    free(b);
+}
+
+int main() {
+    int mode, row, col;
+    printf("Enter 1 to transpose a matrix, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter n: ");
+        scanf("%d", &row);
+        benchmark(row);
+        return 0;
+    }
+    printf("Enter number of rows and columns: ");
+    scanf("%d %d", &row, &col);
+    int *matrix = (int *)malloc((size_t)row * col * sizeof(int) + 1);
+    printf("Enter elements of the matrix:\n");
+    for (size_t i = 0; i < (size_t)row * col; i++) {
+        scanf("%d", &matrix[i]);
+    }
+    if (row == col) {
+        transposeSquareInPlace(matrix, row);
+    } else {
+        transposeRectInPlace(matrix, row, col);
+    }
+    printf("Transposed matrix:\n");
+    for (int i = 0; i < col; i++) {
+        for (int j = 0; j < row; j++) {
+            printf("%d ", matrix[(size_t)i * row + j]);
+        }
+        printf("\n");
+    }
+    free(matrix);
+    return 0;
+}
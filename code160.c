@@ -0,0 +1,307 @@
+//Add two matrices and find the sum of all elements and the trace (sum of the main diagonal) of the result without storing the result. Matrices are stored row-major with every row starting on a 64-byte boundary. An expression such as A + B is kept as a small tree and is only evaluated when sum(), trace() or materialize() asks for it, one row at a time, so the work is fused into one pass over A and B. sum() splits the rows across one thread per core once the matrix is large enough (link with -pthread). Operands of + and - must have the same shape; a mismatch gives an INVALID node instead of reading past the smaller matrix. Mode 2 times the fused sum against adding into a temporary matrix first.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define PARALLEL_MIN (1 << 20)   /* elements below which sum() stays on one thread */
+
+typedef struct {
+    int rows, cols;
+    int stride;     /* elements per row, padded so every row starts on a 64-byte boundary */
+    int *data;
+} Matrix;
+
+Matrix matrixCreate(int rows, int cols) {
+    Matrix m;
+    m.rows = rows;
+    m.cols = cols;
+    m.stride = (cols + 15) / 16 * 16;
+    size_t bytes = (size_t)rows * m.stride * sizeof(int);
+    m.data = (int *)aligned_alloc(64, bytes > 0 ? bytes : 64);
+    memset(m.data, 0, bytes);
+    return m;
+}
+
+enum { LEAF_MATRIX, ADD, SUBTRACT, SCALE, INVALID };
+
+typedef struct Expr {
+    int kind;
+    const Matrix *matrix;           /* LEAF_MATRIX */
+    const struct Expr *left, *right; /* ADD, SUBTRACT; SCALE uses left */
+    int factor;                     /* SCALE */
+    int rows, cols;
+} Expr;
+
+Expr leaf(const Matrix *m) {
+    Expr e = {LEAF_MATRIX, m, NULL, NULL, 0, m->rows, m->cols};
+    return e;
+}
+
+/* Element-wise operands must agree in shape; otherwise the node is INVALID with a 0 x 0
+   shape, and so is every node built on top of it, so nothing is ever evaluated from it. */
+Expr elementWise(int kind, const Expr *a, const Expr *b) {
+    if (a->kind == INVALID || b->kind == INVALID || a->rows != b->rows || a->cols != b->cols) {
+        Expr bad = {INVALID, NULL, NULL, NULL, 0, 0, 0};
+        return bad;
+    }
+    Expr e = {kind, NULL, a, b, 0, a->rows, a->cols};
+    return e;
+}
+
+Expr add(const Expr *a, const Expr *b) {
+    return elementWise(ADD, a, b);
+}
+
+Expr subtract(const Expr *a, const Expr *b) {
+    return elementWise(SUBTRACT, a, b);
+}
+
+Expr scale(const Expr *a, int factor) {
+    Expr e = {SCALE, NULL, a, NULL, factor, a->rows, a->cols};
+    if (a->kind == INVALID) {
+        e.kind = INVALID;
+        e.left = NULL;
+    }
+    return e;
+}
+
+/* Evaluates row i of e into out. scratch holds one spare row per tree level, so nothing the
+   size of the matrix is ever allocated; the loops are simple enough for the compiler to vectorize. */
+void evalRow(const Expr *e, int i, long long *out, long long *scratch) {
+    int cols = e->cols;
+    if (e->kind == LEAF_MATRIX) {
+        const int *row = e->matrix->data + (size_t)i * e->matrix->stride;
+        for (int j = 0; j < cols; j++) {
+            out[j] = row[j];
+        }
+        return;
+    }
+    evalRow(e->left, i, out, scratch + cols);
+    if (e->kind == SCALE) {
+        for (int j = 0; j < cols; j++) {
+            out[j] *= e->factor;
+        }
+        return;
+    }
+    evalRow(e->right, i, scratch, scratch + cols);
+    long long sign = e->kind == ADD ? 1 : -1;
+    for (int j = 0; j < cols; j++) {
+        out[j] += sign * scratch[j];
+    }
+}
+
+/* Evaluates the single element (i, j), used where only a few elements are needed. */
+long long evalAt(const Expr *e, int i, int j) {
+    if (e->kind == LEAF_MATRIX) {
+        return e->matrix->data[(size_t)i * e->matrix->stride + j];
+    }
+    if (e->kind == SCALE) {
+        return evalAt(e->left, i, j) * e->factor;
+    }
+    long long a = evalAt(e->left, i, j), b = evalAt(e->right, i, j);
+    return e->kind == ADD ? a + b : a - b;
+}
+
+int depth(const Expr *e) {
+    if (e->kind == LEAF_MATRIX) {
+        return 1;
+    }
+    int d = depth(e->left);
+    if (e->right != NULL && depth(e->right) > d) {
+        d = depth(e->right);
+    }
+    return d + 1;
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+/* Rows [first, last) of one thread, each with its own scratch rows. */
+typedef struct {
+    const Expr *e;
+    int first, last;
+    long long total;
+} RowRange;
+
+void *sumRows(void *arg) {
+    RowRange *r = (RowRange *)arg;
+    const Expr *e = r->e;
+    long long *buffer = (long long *)malloc(((size_t)depth(e) + 1) * (e->cols + 1) * sizeof(long long));
+    long long total = 0;
+    for (int i = r->first; i < r->last; i++) {
+        evalRow(e, i, buffer, buffer + e->cols);
+        for (int j = 0; j < e->cols; j++) {
+            total += buffer[j];
+        }
+    }
+    free(buffer);
+    r->total = total;
+    return NULL;
+}
+
+/* Sum of all elements. Rows are independent, so above PARALLEL_MIN elements they are cut into
+   one contiguous range per thread; the calling thread takes the first range. */
+long long sum(const Expr *e, int threads) {
+    if (e->kind == INVALID) {
+        return 0;
+    }
+    if ((long long)e->rows * e->cols < PARALLEL_MIN) {
+        threads = 1;
+    }
+    threads = threads < e->rows ? threads : e->rows;
+    threads = threads < 1 ? 1 : threads > 64 ? 64 : threads;
+    RowRange ranges[64];
+    pthread_t ids[64];
+    for (int t = 0; t < threads; t++) {
+        ranges[t].e = e;
+        ranges[t].first = (int)((long long)e->rows * t / threads);
+        ranges[t].last = (int)((long long)e->rows * (t + 1) / threads);
+    }
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, sumRows, &ranges[t]);
+    }
+    sumRows(&ranges[0]);
+    long long total = ranges[0].total;
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+        total += ranges[t].total;
+    }
+    return total;
+}
+
+/* Trace touches only the n diagonal elements instead of the whole matrix. */
+long long trace(const Expr *e) {
+    long long total = 0;
+    if (e->kind == INVALID) {
+        return 0;
+    }
+    int n = e->rows < e->cols ? e->rows : e->cols;
+    for (int i = 0; i < n; i++) {
+        total += evalAt(e, i, i);
+    }
+    return total;
+}
+
+/* Writes the expression into a new matrix when the elements themselves are needed. */
+Matrix materialize(const Expr *e) {
+    Matrix m = matrixCreate(e->rows, e->cols);
+    if (e->kind == INVALID) {
+        return m;
+    }
+    long long *buffer = (long long *)malloc(((size_t)depth(e) + 1) * (e->cols + 1) * sizeof(long long));
+    for (int i = 0; i < e->rows; i++) {
+        evalRow(e, i, buffer, buffer + e->cols);
+        for (int j = 0; j < e->cols; j++) {
+            m.data[(size_t)i * m.stride + j] = (int)buffer[j];
+        }
+    }
+    free(buffer);
+    return m;
+}
+
+void readMatrix(Matrix *m) {
+    for (int i = 0; i < m->rows; i++) {
+        for (int j = 0; j < m->cols; j++) {
+            scanf("%d", &m->data[(size_t)i * m->stride + j]);
+        }
+    }
+}
+
+/* Wall-clock time; clock() would add up the CPU time of all threads. */
+double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* sum(A + B) fused against the two-pass version that stores A + B first. */
+void benchmark(int n) {
+    Matrix a = matrixCreate(n, n), b = matrixCreate(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            a.data[(size_t)i * a.stride + j] = rand() % 1000;
+            b.data[(size_t)i * b.stride + j] = rand() % 1000;
+        }
+    }
+    Expr ea = leaf(&a), eb = leaf(&b);
+    Expr sumExpr = add(&ea, &eb);
+    double start = seconds();
+    long long fused = sum(&sumExpr, 1);
+    double fusedTime = seconds() - start;
+    int threads = coreCount();
+    start = seconds();
+    long long parallel = sum(&sumExpr, threads);
+    double parallelTime = seconds() - start;
+
+    start = seconds();
+    Matrix temp = matrixCreate(n, n);
+    long long twoPass = 0;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            size_t k = (size_t)i * temp.stride + j;
+            temp.data[k] = a.data[k] + b.data[k];
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            twoPass += temp.data[(size_t)i * temp.stride + j];
+        }
+    }
+    double twoPassTime = seconds() - start;
+    printf("fused: %.3f s, fused on %d threads: %.3f s, with temporary: %.3f s %s\n", fusedTime,
+           threads, parallelTime, twoPassTime, fused == twoPass && parallel == twoPass ? "" : "(MISMATCH)");
+    free(a.data);
+    free(b.data);
+    free(temp.data);
+}
+
+int main() {
+    int mode, r, c;
+    printf("Enter 1 to add two matrices, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter n: ");
+        scanf("%d", &r);
+        benchmark(r);
+        return 0;
+    }
+    printf("Enter number of rows and columns of matrix: ");
+    scanf("%d%d", &r, &c);
+    Matrix a = matrixCreate(r, c), b = matrixCreate(r, c);
+    printf("Enter elements of first matrix:\n");
+    readMatrix(&a);
+    printf("Enter elements of second matrix:\n");
+    readMatrix(&b);
+
+    Expr ea = leaf(&a), eb = leaf(&b);
+    Expr sumExpr = add(&ea, &eb);
+    if (sumExpr.kind == INVALID) {
+        printf("Error: matrices must have the same dimensions.\n");
+        free(a.data);
+        free(b.data);
+        return 1;
+    }
+    printf("Sum of all elements of A + B: %lld\n", sum(&sumExpr, coreCount()));
+    if (r == c) {
+        printf("Trace of A + B: %lld\n", trace(&sumExpr));
+    }
+
+    Matrix result = materialize(&sumExpr);
+    printf("Sum of two matrices:\n");
+    for (int i = 0; i < r; i++) {
+        for (int j = 0; j < c; j++) {
+            printf("%d\t", result.data[(size_t)i * result.stride + j]);
+        }
+        printf("\n");
+    }
+    free(a.data);
+    free(b.data);
+    free(result.data);
+    return 0;
+}
@@ -0,0 +1,205 @@
+//Check if a matrix is symmetric by comparing tile (I, J) with the transpose of tile (J, I) for J >= I only, so every pair is compared once and both tiles stay in cache. The tile rows are shared out between threads (link with -pthread), which share a mismatch flag so all of them stop soon after any tile pair differs. A symmetric matrix can then be stored in packed upper-triangular form, which needs n(n+1)/2 elements instead of n^2. Mode 2 times the tiled check against the element-by-element loop from code75.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define TILE 64
+
+/* Returns 1 when tile (bi, bj) equals the transpose of tile (bj, bi). Tile (bj, bi) is first
+   transposed into a local buffer so both sides are read row by row, and the differences are
+   OR-ed together without branches; that inner loop is the one the compiler vectorizes. */
+int tilePairSymmetric(const int *a, int n, int bi, int bj) {
+    int mirror[TILE][TILE];     /* 16 KB on the stack, one per call, so calls can run on separate threads */
+    int hi = n - bi < TILE ? n - bi : TILE;
+    int wj = n - bj < TILE ? n - bj : TILE;
+    for (int r = 0; r < wj; r++) {
+        const int *row = a + (size_t)(bj + r) * n + bi;
+        for (int c = 0; c < hi; c++) {
+            mirror[c][r] = row[c];
+        }
+    }
+    int diff = 0;
+    for (int r = 0; r < hi; r++) {
+        const int *row = a + (size_t)(bi + r) * n + bj;
+        for (int c = 0; c < wj; c++) {
+            diff |= row[c] ^ mirror[r][c];
+        }
+    }
+    return diff == 0;
+}
+
+typedef struct {
+    const int *a;
+    int n;
+    int nextRow;        /* next tile row to hand out, in units of TILE */
+    int mismatch;       /* set by the first thread that finds a differing pair */
+} SymmetryWork;
+
+/* Takes tile rows from nextRow, top first: row 0 has the most pairs, so the long rows are
+   handed out while the short ones are left to even out the finish. The mismatch flag is
+   checked before every pair, so the other threads stop within one tile of a mismatch. */
+void *symmetryWorker(void *arg) {
+    SymmetryWork *w = (SymmetryWork *)arg;
+    for (;;) {
+        int bi = __sync_fetch_and_add(&w->nextRow, 1) * TILE;
+        if (bi >= w->n) {
+            return NULL;
+        }
+        for (int bj = bi; bj < w->n; bj += TILE) {
+            if (__atomic_load_n(&w->mismatch, __ATOMIC_RELAXED)) {
+                return NULL;
+            }
+            if (!tilePairSymmetric(w->a, w->n, bi, bj)) {
+                __atomic_store_n(&w->mismatch, 1, __ATOMIC_RELAXED);
+                return NULL;
+            }
+        }
+    }
+}
+
+/* Visits only the tile pairs on or above the diagonal, on up to threads threads, and stops
+   at the first mismatch. */
+int isSymmetricTiled(const int *a, int n, int threads) {
+    SymmetryWork work = {a, n, 0, 0};
+    int rows = (n + TILE - 1) / TILE;
+    threads = threads < rows ? threads : rows;
+    threads = threads < 1 ? 1 : threads;
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    /* The calling thread takes rows too. */
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, symmetryWorker, &work);
+    }
+    symmetryWorker(&work);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(ids);
+    return !work.mismatch;
+}
+
+/* The element-by-element check from code75.c: column reads with stride n. */
+int isSymmetricNaive(const int *a, int n) {
+    for (int i = 0; i < n; i++) {
+        for (int j = i + 1; j < n; j++) {
+            if (a[(size_t)i * n + j] != a[(size_t)j * n + i]) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+/* Upper triangle stored row by row: row i holds elements (i, i) .. (i, n-1). */
+typedef struct {
+    int n;
+    int *data;
+} PackedSymmetric;
+
+size_t packedIndex(int n, int i, int j) {
+    if (i > j) {
+        int t = i;
+        i = j;
+        j = t;
+    }
+    return (size_t)i * n - (size_t)i * (i - 1) / 2 + (j - i);
+}
+
+PackedSymmetric pack(const int *a, int n) {
+    PackedSymmetric p;
+    p.n = n;
+    p.data = (int *)malloc(((size_t)n * (n + 1) / 2 + 1) * sizeof(int));
+    int *out = p.data;
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) {
+            *out++ = a[(size_t)i * n + j];
+        }
+    }
+    return p;
+}
+
+int packedGet(const PackedSymmetric *p, int i, int j) {
+    return p->data[packedIndex(p->n, i, j)];
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+/* Wall-clock time; clock() would add up the CPU time of all threads. */
+double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* A symmetric matrix is the worst case: neither check can stop early. */
+void benchmark(int n) {
+    int *a = (int *)malloc((size_t)n * n * sizeof(int));
+    if (a == NULL) {
+        printf("Not enough memory for %d x %d.\n", n, n);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) {
+            a[(size_t)i * n + j] = a[(size_t)j * n + i] = rand();
+        }
+    }
+    double start = seconds();
+    int naive = isSymmetricNaive(a, n);
+    double naiveTime = seconds() - start;
+    start = seconds();
+    int tiled = isSymmetricTiled(a, n, 1);
+    double tiledTime = seconds() - start;
+    int cores = coreCount();
+    start = seconds();
+    int threaded = isSymmetricTiled(a, n, cores);
+    double threadedTime = seconds() - start;
+    printf("naive: %.3f s, tiled: %.3f s, tiled on %d threads: %.3f s %s\n", naiveTime, tiledTime, cores,
+           threadedTime, naive == 1 && tiled == 1 && threaded == 1 ? "" : "(MISMATCH)");
+    free(a);
+}
+
+int main() {
+    int mode, n, m;
+    printf("Enter 1 to check a matrix, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        printf("Enter n: ");
+        scanf("%d", &n);
+        benchmark(n);
+        return 0;
+    }
+    printf("Enter number of rows and columns: ");
+    scanf("%d %d", &n, &m);
+    if (n != m) {
+        printf("Matrix is not symmetric.\n");
+        return 0;
+    }
+    int *matrix = (int *)malloc((size_t)n * n * sizeof(int) + 1);
+    printf("Enter matrix elements:\n");
+    for (size_t i = 0; i < (size_t)n * n; i++) {
+        scanf("%d", &matrix[i]);
+    }
+    if (!isSymmetricTiled(matrix, n, coreCount())) {
+        printf("Matrix is not symmetric.\n");
+        free(matrix);
+        return 0;
+    }
+    printf("Matrix is symmetric.\n");
+    PackedSymmetric packed = pack(matrix, n);
+    free(matrix);
+    printf("Packed storage: %zu elements instead of %zu.\n", (size_t)n * (n + 1) / 2, (size_t)n * n);
+    printf("Matrix rebuilt from packed storage:\n");
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            printf("%d ", packedGet(&packed, i, j));
+        }
+        printf("\n");
+    }
+    free(packed.data);
+    return 0;
+}
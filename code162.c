@@ -0,0 +1,237 @@
+//Check if the elements on the main diagonal and on the anti-diagonal of a square matrix are distinct, in O(n) time, and print the repeated values. Both diagonals are checked in the same pass: repeats inside the main diagonal, repeats inside the anti-diagonal, and repeats across the two diagonals taken together (the centre cell of an odd-order matrix counts once). A bitset is used when the values fall in a small range and an open-addressing hash set otherwise. The matrix is typed in or read from a binary file of 32-bit integers, row by row; only the 2n diagonal cells are read from the file.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#define GROUPS 3    /* 0 = main diagonal, 1 = anti-diagonal, 2 = both together */
+
+/* For every value: a "seen" bit and a "reported" bit per group. */
+typedef struct {
+    int useBitset;
+    int min;
+    unsigned long long *bits;   /* bitset mode: 2 * GROUPS words per 64 values */
+    size_t capacity;            /* hash mode: power of two, at most a quarter full */
+    int *keys;
+    unsigned char *flags;       /* hash mode: 0 = empty slot, otherwise 0x80 | seen/reported bits */
+    size_t bytesUsed;
+} ValueSet;
+
+typedef struct {
+    int *values;
+    int count;
+} DuplicateList;
+
+unsigned long long mix64(unsigned long long x) {
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+/* Picks the bitset when it is smaller than the hash table would be: 6 bits per value in
+   [min, max] against 4 * 2n slots of 5 bytes. */
+int valueSetInit(ValueSet *set, const int *diag, const int *anti, int n) {
+    int min = diag[0], max = diag[0];
+    for (int i = 0; i < n; i++) {
+        min = diag[i] < min ? diag[i] : min;
+        max = diag[i] > max ? diag[i] : max;
+        min = anti[i] < min ? anti[i] : min;
+        max = anti[i] > max ? anti[i] : max;
+    }
+    unsigned long long range = (unsigned long long)((long long)max - min) + 1;
+    set->min = min;
+    set->useBitset = range * 2 * GROUPS / 8 <= (unsigned long long)n * 40;
+    if (set->useBitset) {
+        size_t words = (size_t)((range + 63) / 64) * 2 * GROUPS;
+        set->bits = (unsigned long long *)calloc(words, sizeof(unsigned long long));
+        set->bytesUsed = words * sizeof(unsigned long long);
+        return set->bits != NULL;
+    }
+    set->capacity = 16;
+    while (set->capacity < (size_t)n * 8) {
+        set->capacity *= 2;
+    }
+    set->keys = (int *)malloc(set->capacity * sizeof(int));
+    set->flags = (unsigned char *)calloc(set->capacity, 1);
+    set->bytesUsed = set->capacity * (sizeof(int) + 1);
+    return set->keys != NULL && set->flags != NULL;
+}
+
+void valueSetFree(ValueSet *set) {
+    if (set->useBitset) {
+        free(set->bits);
+    } else {
+        free(set->keys);
+        free(set->flags);
+    }
+}
+
+/* Returns the flag bits of value and where they live (bit offset or hash slot). */
+int getFlags(ValueSet *set, int value, size_t *where) {
+    if (set->useBitset) {
+        size_t offset = (size_t)((long long)value - set->min);
+        const unsigned long long *word = set->bits + offset / 64 * 2 * GROUPS;
+        int flags = 0;
+        for (int b = 0; b < 2 * GROUPS; b++) {
+            flags |= (int)((word[b] >> (offset % 64)) & 1) << b;
+        }
+        *where = offset;
+        return flags;
+    }
+    size_t slot = (size_t)mix64((unsigned long long)(unsigned int)value) & (set->capacity - 1);
+    while (set->flags[slot] && set->keys[slot] != value) {
+        slot = (slot + 1) & (set->capacity - 1);
+    }
+    *where = slot;
+    return set->flags[slot] & 0x7f;
+}
+
+void setFlags(ValueSet *set, int value, size_t where, int flags) {
+    if (set->useBitset) {
+        unsigned long long *word = set->bits + where / 64 * 2 * GROUPS;
+        for (int b = 0; b < 2 * GROUPS; b++) {
+            word[b] |= (unsigned long long)((flags >> b) & 1) << (where % 64);
+        }
+        return;
+    }
+    set->keys[where] = value;
+    set->flags[where] = (unsigned char)(0x80 | flags);
+}
+
+/* Marks value as seen in group; the second time it is seen it goes to the group's list, once. */
+void record(ValueSet *set, int value, int group, DuplicateList *lists) {
+    size_t where;
+    int flags = getFlags(set, value, &where);
+    int seen = 1 << group, reported = 1 << (group + GROUPS);
+    if (!(flags & seen)) {
+        flags |= seen;
+    } else if (!(flags & reported)) {
+        flags |= reported;
+        lists[group].values[lists[group].count++] = value;
+    } else {
+        return;
+    }
+    setFlags(set, value, where, flags);
+}
+
+/* One pass over both diagonals. diag[i] is cell (i, i), anti[i] is cell (i, n-1-i). */
+int checkDiagonals(const int *diag, const int *anti, int n, DuplicateList *lists, ValueSet *set) {
+    if (!valueSetInit(set, diag, anti, n)) {
+        return 0;
+    }
+    for (int i = 0; i < n; i++) {
+        record(set, diag[i], 0, lists);
+        record(set, diag[i], 2, lists);
+        record(set, anti[i], 1, lists);
+        if (i != n - 1 - i) {
+            record(set, anti[i], 2, lists);
+        }
+    }
+    return 1;
+}
+
+/* Reads the 2n diagonal cells of an n x n matrix stored row by row in fp. */
+void loadDiagonals(FILE *fp, int n, int *diag, int *anti) {
+    for (int i = 0; i < n; i++) {
+        fseek(fp, ((long long)i * n + i) * (long long)sizeof(int), SEEK_SET);
+        fread(&diag[i], sizeof(int), 1, fp);
+        fseek(fp, ((long long)i * n + n - 1 - i) * (long long)sizeof(int), SEEK_SET);
+        fread(&anti[i], sizeof(int), 1, fp);
+    }
+}
+
+void printList(const char *name, const DuplicateList *list) {
+    if (list->count == 0) {
+        printf("The %s elements are distinct.\n", name);
+        return;
+    }
+    printf("The %s elements are not distinct. Repeated values:", name);
+    for (int i = 0; i < list->count; i++) {
+        printf(" %d", list->values[i]);
+    }
+    printf("\n");
+}
+
+int main() {
+    int mode, n;
+    int *diag, *anti;
+    printf("Enter 1 to type the matrix, 2 to read it from a binary file: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        char fileName[256];
+        printf("Enter the file name: ");
+        scanf("%255s", fileName);
+        FILE *fp = fopen(fileName, "rb");
+        if (fp == NULL) {
+            printf("Error opening file.\n");
+            return 1;
+        }
+        fseek(fp, 0, SEEK_END);
+        long long count = ftell(fp) / (long long)sizeof(int);
+        n = (int)sqrt((double)count);
+        while ((long long)(n + 1) * (n + 1) <= count) {
+            n++;
+        }
+        while ((long long)n * n > count) {
+            n--;
+        }
+        if ((long long)n * n != count || n == 0) {
+            printf("The file does not hold a square matrix.\n");
+            fclose(fp);
+            return 1;
+        }
+        diag = (int *)malloc((size_t)n * sizeof(int));
+        anti = (int *)malloc((size_t)n * sizeof(int));
+        loadDiagonals(fp, n, diag, anti);
+        fclose(fp);
+        printf("Order of the matrix: %d\n", n);
+    } else {
+        printf("Enter the order of the square matrix: ");
+        scanf("%d", &n);
+        if (n < 1) {
+            printf("Invalid order\n");
+            return 1;
+        }
+        diag = (int *)malloc((size_t)n * sizeof(int));
+        anti = (int *)malloc((size_t)n * sizeof(int));
+        printf("Enter the elements of the matrix:\n");
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                int x;
+                scanf("%d", &x);
+                if (j == i) {
+                    diag[i] = x;
+                }
+                if (j == n - 1 - i) {
+                    anti[i] = x;
+                }
+            }
+        }
+    }
+
+    DuplicateList lists[GROUPS];
+    for (int g = 0; g < GROUPS; g++) {
+        lists[g].values = (int *)malloc((size_t)n * sizeof(int));
+        lists[g].count = 0;
+    }
+    ValueSet set = {0};
+    if (!checkDiagonals(diag, anti, n, lists, &set)) {
+        printf("Not enough memory.\n");
+        return 1;
+    }
+    printList("main diagonal", &lists[0]);
+    printList("anti-diagonal", &lists[1]);
+    printList("combined diagonal", &lists[2]);
+    printf("Used a %s of %zu bytes.\n", set.useBitset ? "bitset" : "hash set", set.bytesUsed);
+
+    valueSetFree(&set);
+    for (int g = 0; g < GROUPS; g++) {
+        free(lists[g].values);
+    }
+    free(diag);
+    free(anti);
+    return 0;
+}
@@ -0,0 +1,361 @@
+//Perform diagonal (wavefront) traversal of a matrix of any size. Anti-diagonal k holds the cells (i, k - i); its exact first and last row are computed once, so no position outside the matrix is ever visited. A kernel is called once per diagonal. The matrix can also be stored in a skewed layout where every anti-diagonal is contiguous, so a kernel walks its cells with unit stride. The cells of one diagonal do not depend on each other, which is what wavefront dynamic programming needs: the example computes the minimum path sum from the top-left to the bottom-right cell (moving right or down) diagonal by diagonal, with the cells of each diagonal split across a pool of threads that meet at a barrier before the next diagonal (link with -pthread). Mode 2 times the traversal and the dynamic programming with each layout.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define GRAIN 2048    /* fewest cells worth giving a thread on one diagonal */
+
+/* First and last row of anti-diagonal k in a rows x cols matrix. */
+void diagonalBounds(int k, int rows, int cols, int *iLo, int *iHi) {
+    *iLo = k - (cols - 1) > 0 ? k - (cols - 1) : 0;
+    *iHi = k < rows - 1 ? k : rows - 1;
+}
+
+typedef void (*DiagonalKernel)(int k, int iLo, int iHi, void *ctx);
+
+/* Calls kernel for k = 0 .. rows + cols - 2 in order. Diagonal k only needs diagonals
+   before it to be finished, so the cells inside one call are the ones that can be split
+   across threads or vector lanes. */
+void forEachDiagonal(int rows, int cols, DiagonalKernel kernel, void *ctx) {
+    for (int k = 0; k <= rows + cols - 2; k++) {
+        int iLo, iHi;
+        diagonalBounds(k, rows, cols, &iLo, &iHi);
+        kernel(k, iLo, iHi, ctx);
+    }
+}
+
+typedef struct {
+    int rows, cols;
+    DiagonalKernel kernel;
+    void *ctx;
+    int threads;
+    pthread_barrier_t *barrier;
+    int id;
+} DiagonalWorker;
+
+/* Every thread walks all diagonals. On each one it takes an equal slice of the rows (only
+   as many threads as have GRAIN cells each take part) and then waits at the barrier, so
+   diagonal k is complete before anyone starts k + 1. */
+void *diagonalWorker(void *arg) {
+    DiagonalWorker *w = (DiagonalWorker *)arg;
+    for (int k = 0; k <= w->rows + w->cols - 2; k++) {
+        int iLo, iHi;
+        diagonalBounds(k, w->rows, w->cols, &iLo, &iHi);
+        int len = iHi - iLo + 1;
+        int active = len / GRAIN < w->threads ? len / GRAIN : w->threads;
+        active = active < 1 ? 1 : active;
+        if (w->id < active) {
+            int lo = iLo + (int)((long long)len * w->id / active);
+            int hi = iLo + (int)((long long)len * (w->id + 1) / active) - 1;
+            w->kernel(k, lo, hi, w->ctx);
+        }
+        pthread_barrier_wait(w->barrier);
+    }
+    return NULL;
+}
+
+/* Like forEachDiagonal, but kernel is called on slices [lo, hi] of each diagonal from up to
+   threads threads at once. Only for kernels whose cells on one diagonal are independent and
+   that accept any slice of it (the print and checksum kernels below need the whole diagonal
+   in order). */
+void forEachDiagonalParallel(int rows, int cols, DiagonalKernel kernel, void *ctx, int threads) {
+    int longest = rows < cols ? rows : cols;
+    int useful = (longest + GRAIN - 1) / GRAIN;
+    threads = threads < useful ? threads : useful;
+    if (threads <= 1) {
+        forEachDiagonal(rows, cols, kernel, ctx);
+        return;
+    }
+    pthread_barrier_t barrier;
+    pthread_barrier_init(&barrier, NULL, threads);
+    DiagonalWorker *workers = (DiagonalWorker *)malloc(threads * sizeof(DiagonalWorker));
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        DiagonalWorker w = {rows, cols, kernel, ctx, threads, &barrier, t};
+        workers[t] = w;
+    }
+    /* The calling thread is worker 0. */
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, diagonalWorker, &workers[t]);
+    }
+    diagonalWorker(&workers[0]);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    pthread_barrier_destroy(&barrier);
+    free(workers);
+    free(ids);
+}
+
+/* Skewed layout: diagonal k starts at offset[k] and holds its cells in increasing i. */
+typedef struct {
+    int rows, cols;
+    size_t *offset;     /* rows + cols entries; the last one is rows * cols */
+} SkewedLayout;
+
+SkewedLayout skewedCreate(int rows, int cols) {
+    SkewedLayout s;
+    s.rows = rows;
+    s.cols = cols;
+    s.offset = (size_t *)malloc((size_t)(rows + cols) * sizeof(size_t));
+    s.offset[0] = 0;
+    for (int k = 0; k <= rows + cols - 2; k++) {
+        int iLo, iHi;
+        diagonalBounds(k, rows, cols, &iLo, &iHi);
+        s.offset[k + 1] = s.offset[k] + (iHi - iLo + 1);
+    }
+    return s;
+}
+
+/* Index of cell (i, j) in the skewed layout. */
+size_t skewedIndex(const SkewedLayout *s, int i, int j) {
+    int iLo, iHi;
+    diagonalBounds(i + j, s->rows, s->cols, &iLo, &iHi);
+    return s->offset[i + j] + (i - iLo);
+}
+
+void toSkewed(const SkewedLayout *s, const int *matrix, int *skewed) {
+    for (int k = 0; k <= s->rows + s->cols - 2; k++) {
+        int iLo, iHi;
+        diagonalBounds(k, s->rows, s->cols, &iLo, &iHi);
+        int *out = skewed + s->offset[k];
+        for (int i = iLo; i <= iHi; i++) {
+            *out++ = matrix[(size_t)i * s->cols + (k - i)];
+        }
+    }
+}
+
+/* ---- Traversal: prints the cells in diagonal order, like code78.c. ---- */
+
+typedef struct {
+    const int *matrix;
+    int cols;
+} PrintContext;
+
+void printDiagonal(int k, int iLo, int iHi, void *ctx) {
+    PrintContext *c = (PrintContext *)ctx;
+    for (int i = iLo; i <= iHi; i++) {
+        printf("%d ", c->matrix[(size_t)i * c->cols + (k - i)]);
+    }
+}
+
+/* ---- Wavefront DP: best[i][j] = cost[i][j] + min(best[i-1][j], best[i][j-1]). ---- */
+
+typedef struct {
+    const int *cost;
+    long long *best;
+    int cols;
+} RowMajorDP;
+
+/* Row-major layout: the cells of a diagonal are cols - 1 elements apart. */
+void minPathRowMajor(int k, int iLo, int iHi, void *ctx) {
+    RowMajorDP *c = (RowMajorDP *)ctx;
+    for (int i = iLo; i <= iHi; i++) {
+        int j = k - i;
+        size_t at = (size_t)i * c->cols + j;
+        long long up = i > 0 ? c->best[at - c->cols] : LLONG_MAX;
+        long long left = j > 0 ? c->best[at - 1] : LLONG_MAX;
+        long long from = up < left ? up : left;
+        /* Only (0, 0) has no predecessor. */
+        c->best[at] = c->cost[at] + (from == LLONG_MAX ? 0 : from);
+    }
+}
+
+typedef struct {
+    const SkewedLayout *layout;
+    const int *cost;    /* both in the skewed layout */
+    long long *best;
+} SkewedDP;
+
+/* Best predecessor of cell i on diagonal k > 0. Whether a neighbour exists follows from the
+   bounds alone, so costs of any sign work; for k > 0 at least one of the two exists. */
+long long minPathCell(const SkewedDP *c, int k, int i, int prevLo, int prevHi) {
+    const long long *prev = c->best + c->layout->offset[k - 1];
+    int j = k - i;
+    long long up = i > 0 && i - 1 >= prevLo ? prev[i - 1 - prevLo] : LLONG_MAX;
+    long long left = j > 0 && i <= prevHi ? prev[i - prevLo] : LLONG_MAX;
+    return up < left ? up : left;
+}
+
+/* Skewed layout: diagonal k reads diagonal k - 1 with unit stride. Cell i needs entries
+   i - 1 and i of the previous diagonal (shifted by its first row); the interior loop has no
+   branches and no dependencies between its iterations, so the compiler vectorizes it.
+   [iLo, iHi] may be any slice of the diagonal; cells are addressed from its first row. */
+void minPathSkewed(int k, int iLo, int iHi, void *ctx) {
+    SkewedDP *c = (SkewedDP *)ctx;
+    int first, last;
+    diagonalBounds(k, c->layout->rows, c->layout->cols, &first, &last);
+    const int *cost = c->cost + c->layout->offset[k] - first;
+    long long *best = c->best + c->layout->offset[k] - first;
+    if (k == 0) {
+        best[0] = cost[0];
+        return;
+    }
+    int prevLo, prevHi;
+    diagonalBounds(k - 1, c->layout->rows, c->layout->cols, &prevLo, &prevHi);
+    const long long *prev = c->best + c->layout->offset[k - 1] - prevLo;
+    /* Cells with both neighbours: i - 1 >= prevLo and i <= prevHi. */
+    int lo = iLo > prevLo + 1 ? iLo : prevLo + 1;
+    int hi = iHi < prevHi ? iHi : prevHi;
+    for (int i = iLo; i <= iHi && i < lo; i++) {
+        best[i] = cost[i] + minPathCell(c, k, i, prevLo, prevHi);
+    }
+    for (int i = lo; i <= hi; i++) {
+        long long up = prev[i - 1], left = prev[i];
+        best[i] = cost[i] + (up < left ? up : left);
+    }
+    for (int i = hi + 1 > lo ? hi + 1 : lo; i <= iHi; i++) {
+        best[i] = cost[i] + minPathCell(c, k, i, prevLo, prevHi);
+    }
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+/* Wall-clock time; clock() would add up the CPU time of all threads. */
+double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+/* ---- Benchmark ---- */
+
+typedef struct {
+    const int *data;
+    int cols;
+    const SkewedLayout *layout;
+    long long checksum;
+    long long position;
+} ChecksumContext;
+
+/* Order-sensitive checksum so that every method must visit the cells in the same order. */
+void checksumRowMajor(int k, int iLo, int iHi, void *ctx) {
+    ChecksumContext *c = (ChecksumContext *)ctx;
+    for (int i = iLo; i <= iHi; i++) {
+        c->checksum += c->data[(size_t)i * c->cols + (k - i)] * ++c->position;
+    }
+}
+
+void checksumSkewed(int k, int iLo, int iHi, void *ctx) {
+    ChecksumContext *c = (ChecksumContext *)ctx;
+    const int *cells = c->data + c->layout->offset[k];
+    long long sum = 0, base = c->position;
+    for (int t = 0; t <= iHi - iLo; t++) {
+        sum += cells[t] * (base + t + 1);
+    }
+    c->checksum += sum;
+    c->position += iHi - iLo + 1;
+}
+
+void benchmark(int rows, int cols) {
+    size_t count = (size_t)rows * cols;
+    int *matrix = (int *)malloc(count * sizeof(int));
+    int *skewed = (int *)malloc(count * sizeof(int));
+    long long *best = (long long *)malloc(count * sizeof(long long));
+    long long *bestSkewed = (long long *)malloc(count * sizeof(long long));
+    long long *bestThreaded = (long long *)malloc(count * sizeof(long long));
+    if (matrix == NULL || skewed == NULL || best == NULL || bestSkewed == NULL || bestThreaded == NULL) {
+        printf("Not enough memory for %d x %d.\n", rows, cols);
+        return;
+    }
+    for (size_t i = 0; i < count; i++) {
+        matrix[i] = rand() % 100;
+    }
+    SkewedLayout layout = skewedCreate(rows, cols);
+    double start = seconds();
+    toSkewed(&layout, matrix, skewed);
+    printf("conversion to skewed layout:   %.3f s\n", seconds() - start);
+
+    /* The guarded loop from code78.c. */
+    start = seconds();
+    long long guarded = 0, position = 0;
+    for (int k = 0; k <= rows + cols - 2; k++) {
+        for (int i = 0; i <= k; i++) {
+            int j = k - i;
+            if (i < rows && j < cols) {
+                guarded += matrix[(size_t)i * cols + j] * ++position;
+            }
+        }
+    }
+    printf("traversal, guarded loop:       %.3f s\n", seconds() - start);
+    ChecksumContext rowCtx = {matrix, cols, &layout, 0, 0};
+    start = seconds();
+    forEachDiagonal(rows, cols, checksumRowMajor, &rowCtx);
+    printf("traversal, exact bounds:       %.3f s\n", seconds() - start);
+    ChecksumContext skewCtx = {skewed, cols, &layout, 0, 0};
+    start = seconds();
+    forEachDiagonal(rows, cols, checksumSkewed, &skewCtx);
+    printf("traversal, skewed layout:      %.3f s %s\n", seconds() - start,
+           guarded == rowCtx.checksum && guarded == skewCtx.checksum ? "" : "(MISMATCH)");
+
+    RowMajorDP rowDP = {matrix, best, cols};
+    start = seconds();
+    forEachDiagonal(rows, cols, minPathRowMajor, &rowDP);
+    printf("wavefront DP, row-major:       %.3f s\n", seconds() - start);
+    SkewedDP skewDP = {&layout, skewed, bestSkewed};
+    start = seconds();
+    forEachDiagonal(rows, cols, minPathSkewed, &skewDP);
+    printf("wavefront DP, skewed layout:   %.3f s %s\n", seconds() - start,
+           best[count - 1] == bestSkewed[count - 1] ? "" : "(MISMATCH)");
+    int cores = coreCount();
+    SkewedDP threadDP = {&layout, skewed, bestThreaded};
+    start = seconds();
+    forEachDiagonalParallel(rows, cols, minPathSkewed, &threadDP, cores);
+    printf("wavefront DP, skewed, %2d thr:  %.3f s %s\n", cores, seconds() - start,
+           best[count - 1] == bestThreaded[count - 1] ? "" : "(MISMATCH)");
+
+    free(matrix);
+    free(skewed);
+    free(best);
+    free(bestSkewed);
+    free(bestThreaded);
+    free(layout.offset);
+}
+
+int main() {
+    int mode, rows, cols;
+    printf("Enter 1 to traverse a matrix, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    printf("Enter number of rows and columns: ");
+    scanf("%d %d", &rows, &cols);
+    if (rows < 1 || cols < 1) {
+        printf("Invalid size\n");
+        return 1;
+    }
+    if (mode == 2) {
+        benchmark(rows, cols);
+        return 0;
+    }
+    size_t count = (size_t)rows * cols;
+    int *matrix = (int *)malloc(count * sizeof(int));
+    printf("Enter matrix elements:\n");
+    for (size_t i = 0; i < count; i++) {
+        scanf("%d", &matrix[i]);
+    }
+    printf("Diagonal Traversal of the matrix:\n");
+    PrintContext printCtx = {matrix, cols};
+    forEachDiagonal(rows, cols, printDiagonal, &printCtx);
+    printf("\n");
+
+    SkewedLayout layout = skewedCreate(rows, cols);
+    int *skewed = (int *)malloc(count * sizeof(int));
+    long long *best = (long long *)malloc(count * sizeof(long long));
+    toSkewed(&layout, matrix, skewed);
+    SkewedDP dp = {&layout, skewed, best};
+    forEachDiagonalParallel(rows, cols, minPathSkewed, &dp, coreCount());
+    printf("Minimum path sum from top-left to bottom-right: %lld\n",
+           best[skewedIndex(&layout, rows - 1, cols - 1)]);
+
+    free(matrix);
+    free(skewed);
+    free(best);
+    free(layout.offset);
+    return 0;
+}
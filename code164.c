@@ -0,0 +1,520 @@
+//Find the sum of each row and each column of a large sparse matrix stored in compressed sparse row (CSR) form, transpose it into compressed sparse column (CSC) form and multiply it by a vector. The matrix is read from a coordinate (COO) text file in Matrix Market format, the format SuiteSparse collection matrices come in: comment lines starting with %, a line "rows cols entries", then one "row col value" line per entry with 1-based indices ("pattern" files have no values, "symmetric" and "skew-symmetric" files list one triangle; complex and dense "array" files are rejected). Row sums, column sums (over the CSC form) and the product are split into ranges of rows or columns with about the same number of entries, one per thread (link with -pthread). Mode 2 times the sparse operations against the dense ones on a random matrix with a given number of entries per row.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define BUCKETS 1024   /* column groups in the first pass of csrToCsc */
+
+/* Row i holds entries rowStart[i] .. rowStart[i + 1] - 1 of col and value. */
+typedef struct {
+    int rows, cols;
+    long long entries;
+    long long *rowStart;
+    int *col;
+    double *value;
+} CsrMatrix;
+
+/* Column j holds entries colStart[j] .. colStart[j + 1] - 1 of row and value. */
+typedef struct {
+    int rows, cols;
+    long long entries;
+    long long *colStart;
+    int *row;
+    double *value;
+} CscMatrix;
+
+/* Builds CSR from coordinate triples with a counting sort on the row: one pass counts the
+   entries per row, a prefix sum gives each row its start, a second pass places the entries.
+   Entries keep their file order inside a row. */
+CsrMatrix csrFromCoo(int rows, int cols, long long entries, const int *cooRow, const int *cooCol,
+                     const double *cooValue) {
+    CsrMatrix a;
+    a.rows = rows;
+    a.cols = cols;
+    a.entries = entries;
+    a.rowStart = (long long *)calloc((size_t)rows + 1, sizeof(long long));
+    a.col = (int *)malloc((size_t)entries * sizeof(int) + 1);
+    a.value = (double *)malloc((size_t)entries * sizeof(double) + 1);
+    for (long long e = 0; e < entries; e++) {
+        a.rowStart[cooRow[e] + 1]++;
+    }
+    for (int i = 0; i < rows; i++) {
+        a.rowStart[i + 1] += a.rowStart[i];
+    }
+    long long *next = (long long *)malloc(((size_t)rows + 1) * sizeof(long long));
+    memcpy(next, a.rowStart, ((size_t)rows + 1) * sizeof(long long));
+    for (long long e = 0; e < entries; e++) {
+        long long at = next[cooRow[e]]++;
+        a.col[at] = cooCol[e];
+        a.value[at] = cooValue[e];
+    }
+    free(next);
+    return a;
+}
+
+void lowerCase(char *text) {
+    for (; *text != '\0'; text++) {
+        *text = (char)tolower((unsigned char)*text);
+    }
+}
+
+/* Reads a Matrix Market coordinate file. Returns 0 and prints why on failure. Only the
+   "%%MatrixMarket object format field symmetry" banner on the first line describes the
+   file; other % lines are comments. A file without the banner is read as general real. */
+int readMatrixMarket(const char *fileName, CsrMatrix *a) {
+    FILE *fp = fopen(fileName, "r");
+    if (fp == NULL) {
+        printf("Error opening file.\n");
+        return 0;
+    }
+    char line[1024];
+    char banner[32] = "", object[32] = "matrix", format[32] = "coordinate", field[32] = "real",
+         symmetry[32] = "general";
+    long long declared;
+    int rows, cols;
+    if (fgets(line, sizeof(line), fp) == NULL) {
+        line[0] = '\0';
+    }
+    if (strncmp(line, "%%MatrixMarket", 14) == 0) {
+        if (sscanf(line, "%31s %31s %31s %31s %31s", banner, object, format, field, symmetry) != 5) {
+            printf("Incomplete %%%%MatrixMarket banner.\n");
+            fclose(fp);
+            return 0;
+        }
+        lowerCase(object);
+        lowerCase(format);
+        lowerCase(field);
+        lowerCase(symmetry);
+    }
+    int pattern = strcmp(field, "pattern") == 0;
+    int symmetric = strcmp(symmetry, "symmetric") == 0;
+    int skew = strcmp(symmetry, "skew-symmetric") == 0;
+    if (strcmp(object, "matrix") != 0 || strcmp(format, "coordinate") != 0) {
+        printf("Only coordinate matrices are supported, not \"%s %s\".\n", object, format);
+        fclose(fp);
+        return 0;
+    }
+    if (!pattern && strcmp(field, "real") != 0 && strcmp(field, "integer") != 0) {
+        printf("Unsupported field \"%s\" (complex values are not supported).\n", field);
+        fclose(fp);
+        return 0;
+    }
+    if (!symmetric && !skew && strcmp(symmetry, "general") != 0) {
+        printf("Unsupported symmetry \"%s\".\n", symmetry);
+        fclose(fp);
+        return 0;
+    }
+    while (line[0] == '%' || line[0] == '\n' || line[0] == '\r') {
+        if (fgets(line, sizeof(line), fp) == NULL) {
+            line[0] = '\0';
+            break;
+        }
+    }
+    if (sscanf(line, "%d %d %lld", &rows, &cols, &declared) != 3) {
+        printf("Missing \"rows cols entries\" line.\n");
+        fclose(fp);
+        return 0;
+    }
+    /* A symmetric file can expand to twice its entries. */
+    long long capacity = symmetric || skew ? 2 * declared : declared;
+    int *cooRow = (int *)malloc((size_t)capacity * sizeof(int) + 1);
+    int *cooCol = (int *)malloc((size_t)capacity * sizeof(int) + 1);
+    double *cooValue = (double *)malloc((size_t)capacity * sizeof(double) + 1);
+    long long entries = 0;
+    for (long long e = 0; e < declared; e++) {
+        int i, j;
+        double v = 1;
+        if (fscanf(fp, "%d %d", &i, &j) != 2 || (!pattern && fscanf(fp, "%lf", &v) != 1)) {
+            printf("File ends after %lld of %lld entries.\n", e, declared);
+            break;
+        }
+        if (i < 1 || i > rows || j < 1 || j > cols) {
+            printf("Entry %d %d is outside the matrix.\n", i, j);
+            free(cooRow);
+            free(cooCol);
+            free(cooValue);
+            fclose(fp);
+            return 0;
+        }
+        cooRow[entries] = i - 1;
+        cooCol[entries] = j - 1;
+        cooValue[entries++] = v;
+        if ((symmetric || skew) && i != j) {
+            cooRow[entries] = j - 1;
+            cooCol[entries] = i - 1;
+            cooValue[entries++] = skew ? -v : v;
+        }
+    }
+    fclose(fp);
+    *a = csrFromCoo(rows, cols, entries, cooRow, cooCol, cooValue);
+    free(cooRow);
+    free(cooCol);
+    free(cooValue);
+    return 1;
+}
+
+void csrFree(CsrMatrix *a) {
+    free(a->rowStart);
+    free(a->col);
+    free(a->value);
+}
+
+/* Segments lo .. hi - 1 of a compressed matrix: rows of CSR or columns of CSC. */
+typedef struct {
+    const long long *start;
+    const int *index;
+    const double *value;
+    const double *x;    /* NULL: plain sums, otherwise sum of value * x[index] */
+    double *out;
+    int lo, hi;
+} SegmentRange;
+
+void *segmentWorker(void *arg) {
+    SegmentRange *r = (SegmentRange *)arg;
+    for (int i = r->lo; i < r->hi; i++) {
+        double s = 0;
+        if (r->x == NULL) {
+            for (long long e = r->start[i]; e < r->start[i + 1]; e++) {
+                s += r->value[e];
+            }
+        } else {
+            for (long long e = r->start[i]; e < r->start[i + 1]; e++) {
+                s += r->value[e] * r->x[r->index[e]];
+            }
+        }
+        r->out[i] = s;
+    }
+    return NULL;
+}
+
+/* Every segment is independent, so the segments are cut into one range per thread. The cuts
+   fall where the running entry count crosses total * t / threads (a binary search in start),
+   so a few dense rows do not leave one thread with most of the work. */
+void runSegments(const long long *start, const int *index, const double *value, const double *x,
+                 double *out, int count, int threads) {
+    SegmentRange *ranges = (SegmentRange *)malloc(threads * sizeof(SegmentRange));
+    pthread_t *ids = (pthread_t *)malloc(threads * sizeof(pthread_t));
+    int lo = 0;
+    for (int t = 0; t < threads; t++) {
+        long long target = start[count] * (t + 1) / threads;
+        int a = lo, b = count;
+        while (a < b) {
+            int mid = a + (b - a) / 2;
+            if (start[mid] < target) {
+                a = mid + 1;
+            } else {
+                b = mid;
+            }
+        }
+        int hi = t == threads - 1 ? count : a;
+        SegmentRange r = {start, index, value, x, out, lo, hi};
+        ranges[t] = r;
+        lo = hi;
+    }
+    /* The calling thread takes range 0. */
+    for (int t = 1; t < threads; t++) {
+        pthread_create(&ids[t], NULL, segmentWorker, &ranges[t]);
+    }
+    segmentWorker(&ranges[0]);
+    for (int t = 1; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+    }
+    free(ranges);
+    free(ids);
+}
+
+void rowSums(const CsrMatrix *a, double *sums, int threads) {
+    runSegments(a->rowStart, a->col, a->value, NULL, sums, a->rows, threads);
+}
+
+/* Column sums straight from CSR scatter into sums, so they cannot be split by rows without
+   a private sums array per thread; this sequential version is kept as the baseline and the
+   cross-check for cscColSums. */
+void colSums(const CsrMatrix *a, double *sums) {
+    memset(sums, 0, (size_t)a->cols * sizeof(double));
+    for (long long e = 0; e < a->entries; e++) {
+        sums[a->col[e]] += a->value[e];
+    }
+}
+
+/* CSR -> CSC is the same counting sort as csrFromCoo, keyed on the column, but done in two
+   passes so that no pass scatters across the whole matrix. Pass 1 splits the entries into at
+   most BUCKETS groups of neighbouring columns (few enough write streams for the cache).
+   Pass 2 counting-sorts each group on its own, and its columns and entries fit in cache.
+   Rows are visited in order and both passes are stable, so the row indices inside every
+   column come out sorted. */
+CscMatrix csrToCsc(const CsrMatrix *a) {
+    CscMatrix t;
+    t.rows = a->rows;
+    t.cols = a->cols;
+    t.entries = a->entries;
+    t.colStart = (long long *)calloc((size_t)a->cols + 1, sizeof(long long));
+    t.row = (int *)malloc((size_t)a->entries * sizeof(int) + 1);
+    t.value = (double *)malloc((size_t)a->entries * sizeof(double) + 1);
+    int shift = 0;
+    while (((long long)a->cols - 1) >> shift >= BUCKETS) {
+        shift++;
+    }
+    int buckets = a->cols > 0 ? ((a->cols - 1) >> shift) + 1 : 0;
+    long long bucketStart[BUCKETS + 1] = {0}, bucketNext[BUCKETS];
+    for (long long e = 0; e < a->entries; e++) {
+        bucketStart[(a->col[e] >> shift) + 1]++;
+    }
+    for (int b = 0; b < buckets; b++) {
+        bucketStart[b + 1] += bucketStart[b];
+        bucketNext[b] = bucketStart[b];
+    }
+
+    /* Pass 1: entries grouped by bucket, column kept alongside. */
+    int *bucketCol = (int *)malloc((size_t)a->entries * sizeof(int) + 1);
+    for (int i = 0; i < a->rows; i++) {
+        for (long long e = a->rowStart[i]; e < a->rowStart[i + 1]; e++) {
+            long long at = bucketNext[a->col[e] >> shift]++;
+            t.row[at] = i;
+            t.value[at] = a->value[e];
+            bucketCol[at] = a->col[e];
+        }
+    }
+
+    /* Pass 2: each bucket is copied out and counting-sorted back into its own range. */
+    long long largest = 0;
+    for (int b = 0; b < buckets; b++) {
+        largest = bucketStart[b + 1] - bucketStart[b] > largest ? bucketStart[b + 1] - bucketStart[b] : largest;
+    }
+    int *rowCopy = (int *)malloc((size_t)largest * sizeof(int) + 1);
+    double *valueCopy = (double *)malloc((size_t)largest * sizeof(double) + 1);
+    long long *next = (long long *)malloc(((size_t)1 << shift) * sizeof(long long));
+    for (int b = 0; b < buckets; b++) {
+        int firstCol = b << shift;
+        int lastCol = (b + 1) << shift < a->cols ? (b + 1) << shift : a->cols;
+        long long lo = bucketStart[b], count = bucketStart[b + 1] - lo;
+        for (long long e = lo; e < lo + count; e++) {
+            t.colStart[bucketCol[e] + 1]++;
+        }
+        t.colStart[firstCol] = lo;
+        for (int j = firstCol; j < lastCol; j++) {
+            t.colStart[j + 1] += t.colStart[j];
+            next[j - firstCol] = t.colStart[j];
+        }
+        memcpy(rowCopy, t.row + lo, (size_t)count * sizeof(int));
+        memcpy(valueCopy, t.value + lo, (size_t)count * sizeof(double));
+        for (long long e = 0; e < count; e++) {
+            long long at = next[bucketCol[lo + e] - firstCol]++;
+            t.row[at] = rowCopy[e];
+            t.value[at] = valueCopy[e];
+        }
+    }
+    free(bucketCol);
+    free(rowCopy);
+    free(valueCopy);
+    free(next);
+    return t;
+}
+
+void cscFree(CscMatrix *t) {
+    free(t->colStart);
+    free(t->row);
+    free(t->value);
+}
+
+/* In CSC every column is a contiguous segment, so column sums split like row sums. */
+void cscColSums(const CscMatrix *t, double *sums, int threads) {
+    runSegments(t->colStart, t->row, t->value, NULL, sums, t->cols, threads);
+}
+
+/* y = A * x, split by rows like rowSums. */
+void spmv(const CsrMatrix *a, const double *x, double *y, int threads) {
+    runSegments(a->rowStart, a->col, a->value, x, y, a->rows, threads);
+}
+
+int coreCount(void) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    return cores < 1 ? 1 : cores > 64 ? 64 : (int)cores;
+}
+
+/* Wall-clock time; clock() would add up the CPU time of all threads. */
+double seconds(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+double maxDifference(const double *a, const double *b, int n) {
+    double m = 0;
+    for (int i = 0; i < n; i++) {
+        double d = a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        m = d > m ? d : m;
+    }
+    return m;
+}
+
+/* Random n x n matrix with perRow entries in every row. The dense path (row sums and
+   matrix-vector product over all n^2 cells) only runs when n^2 doubles fit in 2 GB. */
+void benchmark(int n, int perRow) {
+    long long entries = (long long)n * perRow;
+    int *cooRow = (int *)malloc((size_t)entries * sizeof(int));
+    int *cooCol = (int *)malloc((size_t)entries * sizeof(int));
+    double *cooValue = (double *)malloc((size_t)entries * sizeof(double));
+    double *x = (double *)malloc((size_t)n * sizeof(double));
+    double *y = (double *)malloc((size_t)n * sizeof(double));
+    double *sums = (double *)malloc((size_t)n * sizeof(double));
+    double *colCheck = (double *)malloc((size_t)n * sizeof(double));
+    if (cooRow == NULL || cooCol == NULL || cooValue == NULL || x == NULL || y == NULL || sums == NULL ||
+        colCheck == NULL) {
+        printf("Not enough memory.\n");
+        return;
+    }
+    for (long long e = 0; e < entries; e++) {
+        cooRow[e] = (int)(e / perRow);
+        cooCol[e] = (int)(((unsigned long long)rand() << 16 ^ rand()) % n);
+        cooValue[e] = rand() % 10 + 1;
+    }
+    for (int i = 0; i < n; i++) {
+        x[i] = (double)(i % 7) - 3;
+    }
+
+    double start = seconds();
+    CsrMatrix a = csrFromCoo(n, n, entries, cooRow, cooCol, cooValue);
+    printf("COO -> CSR:        %8.3f s\n", seconds() - start);
+    free(cooRow);
+    free(cooCol);
+    free(cooValue);
+    int cores = coreCount();
+    printf("(threaded lines use %d threads)\n", cores);
+    start = seconds();
+    rowSums(&a, sums, 1);
+    printf("CSR row sums:      %8.3f s\n", seconds() - start);
+    start = seconds();
+    rowSums(&a, sums, cores);
+    printf("  threaded:        %8.3f s\n", seconds() - start);
+    start = seconds();
+    colSums(&a, colCheck);
+    printf("CSR column sums:   %8.3f s\n", seconds() - start);
+    start = seconds();
+    CscMatrix t = csrToCsc(&a);
+    printf("CSR -> CSC:        %8.3f s\n", seconds() - start);
+    start = seconds();
+    cscColSums(&t, sums, cores);
+    printf("CSC column sums:   %8.3f s %s\n", seconds() - start,
+           maxDifference(sums, colCheck, n) < 1e-9 ? "" : "(MISMATCH)");
+    start = seconds();
+    spmv(&a, x, y, 1);
+    double sparseTime = seconds() - start;
+    printf("CSR SpMV:          %8.3f s (%.2f GFLOP/s)\n", sparseTime, 2.0 * entries / sparseTime / 1e9);
+    start = seconds();
+    spmv(&a, x, y, cores);
+    sparseTime = seconds() - start;
+    printf("  threaded:        %8.3f s (%.2f GFLOP/s)\n", sparseTime, 2.0 * entries / sparseTime / 1e9);
+
+    if ((double)n * n * sizeof(double) <= 2e9) {
+        double *dense = (double *)calloc((size_t)n * n, sizeof(double));
+        double *yDense = (double *)malloc((size_t)n * sizeof(double));
+        for (int i = 0; i < n; i++) {
+            for (long long e = a.rowStart[i]; e < a.rowStart[i + 1]; e++) {
+                dense[(size_t)i * n + a.col[e]] += a.value[e];
+            }
+        }
+        start = seconds();
+        for (int i = 0; i < n; i++) {
+            double s = 0;
+            for (int j = 0; j < n; j++) {
+                s += dense[(size_t)i * n + j];
+            }
+            sums[i] = s;
+        }
+        printf("dense row sums:    %8.3f s\n", seconds() - start);
+        start = seconds();
+        for (int i = 0; i < n; i++) {
+            double s = 0;
+            for (int j = 0; j < n; j++) {
+                s += dense[(size_t)i * n + j] * x[j];
+            }
+            yDense[i] = s;
+        }
+        printf("dense mat-vec:     %8.3f s %s\n", seconds() - start,
+               maxDifference(y, yDense, n) < 1e-9 ? "" : "(MISMATCH)");
+        free(dense);
+        free(yDense);
+    } else {
+        printf("dense path skipped: %d x %d doubles do not fit in 2 GB\n", n, n);
+    }
+    csrFree(&a);
+    cscFree(&t);
+    free(x);
+    free(y);
+    free(sums);
+    free(colCheck);
+}
+
+void printSums(const char *name, const double *sums, int count) {
+    int shown = count < 20 ? count : 20;
+    printf("%s sums:\n", name);
+    for (int i = 0; i < shown; i++) {
+        printf("%s %d: %g\n", name, i + 1, sums[i]);
+    }
+    if (shown < count) {
+        printf("... (%d more)\n", count - shown);
+    }
+}
+
+int main() {
+    int mode;
+    printf("Enter 1 to read a matrix from a COO file, 2 to run the benchmark: ");
+    scanf("%d", &mode);
+    if (mode == 2) {
+        int n, perRow;
+        printf("Enter n and the number of entries per row: ");
+        scanf("%d %d", &n, &perRow);
+        if (n < 1 || perRow < 1) {
+            printf("Invalid size\n");
+            return 1;
+        }
+        benchmark(n, perRow);
+        return 0;
+    }
+
+    char fileName[256];
+    printf("Enter the file name: ");
+    scanf("%255s", fileName);
+    CsrMatrix a;
+    if (!readMatrixMarket(fileName, &a)) {
+        return 1;
+    }
+    printf("%d x %d matrix with %lld entries\n", a.rows, a.cols, a.entries);
+    int cores = coreCount();
+    double *rs = (double *)malloc(((size_t)a.rows + 1) * sizeof(double));
+    double *cs = (double *)malloc(((size_t)a.cols + 1) * sizeof(double));
+    rowSums(&a, rs, cores);
+    CscMatrix t = csrToCsc(&a);
+    cscColSums(&t, cs, cores);
+    printSums("Row", rs, a.rows);
+    printSums("Column", cs, a.cols);
+
+    /* Cross-checks: A * ones gives the row sums, and scattering CSR gives the column sums. */
+    double *ones = (double *)calloc((size_t)a.cols + 1, sizeof(double));
+    double *y = (double *)malloc(((size_t)a.rows + 1) * sizeof(double));
+    double *scattered = (double *)malloc(((size_t)a.cols + 1) * sizeof(double));
+    for (int j = 0; j < a.cols; j++) {
+        ones[j] = 1;
+    }
+    spmv(&a, ones, y, cores);
+    colSums(&a, scattered);
+    double worst = maxDifference(y, rs, a.rows);
+    double worstCol = maxDifference(scattered, cs, a.cols);
+    worst = worstCol > worst ? worstCol : worst;
+    printf("SpMV and CSC agree with the sums: %s\n", worst < 1e-6 ? "yes" : "no");
+
+    csrFree(&a);
+    cscFree(&t);
+    free(rs);
+    free(cs);
+    free(ones);
+    free(y);
+    free(scattered);
+    return 0;
+}
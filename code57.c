@@ -8,7 +8,7 @@ scanf("%d",&n);
 int arr[n];
 printf("enter elements of array:");
 for(i=0;i<n;i++){
-    scanf("%d",&arr[n]);
+    scanf("%d",&arr[i]);
 }
 max=arr[0];
 min=arr[0];
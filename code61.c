@@ -18,11 +18,9 @@ for(i=0;i<n;i++){
         break ;
     }
 }
-for(i=0;i<n;i++){
-if(arr[i]!=j){
+if(count==0){
     printf("the no is not found");
 }
-}
 return 0;
 
 
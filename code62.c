@@ -10,8 +10,13 @@ printf("enter elements of array:");
 for(i=0;i<n;i++){
     scanf("%d",&array[i]);
 }
-for(i=n-1;i>=0;i--){
-    printf("%d",array[i]);
+for(i=0,j=n-1;i<j;i++,j--){
+    int temp=array[i];
+    array[i]=array[j];
+    array[j]=temp;
+}
+for(i=0;i<n;i++){
+    printf("%d ",array[i]);
 }
 return 0;
 
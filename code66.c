@@ -5,14 +5,14 @@ int main(){
 int i,n,x,pos=0;
 printf("enter size of array:");
 scanf("%d",&n);
-int arr[n],arr1[n+1];
+int arr[n+1];
 printf("enter sorted elements:");
 for(i=0;i<n;i++){
     scanf("%d",&arr[i]);
 }
  printf("Enter element to insert: ");
     scanf("%d", &x);
-    if(pos < n && arr[pos] < x) {
+    while(pos < n && arr[pos] < x) {
         pos++;
     }
     for (i = n; i > pos; i--) {
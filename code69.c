@@ -2,17 +2,33 @@
 
 #include<stdio.h>
 int main(){
-int i,n;
+int i,n,largest,second=0,found=0;
 printf("enter number of elemnts:");
 scanf("%d",&n);
 int arr[n];
 for(i=0;i<n;i++){
     scanf("%d",&arr[i]);
 }
-for(i=0;i<n;i++){
-    
+largest=arr[0];
+for(i=1;i<n;i++){
+    if(arr[i]>largest){
+        second=largest;
+        largest=arr[i];
+        found=1;
+    }
+    else if(arr[i]<largest&&(!found||arr[i]>second)){
+        second=arr[i];
+        found=1;
+    }
+}
+if(found){
+    printf("second largest element is %d",second);
+}
+else{
+    printf("second largest element does not exist");
 }
+return 0;
 
 
 
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -1,10 +1,10 @@
 //Find the transpose of a matrix.
 #include <stdio.h>
 int main() {
-    int matrix[10][10], transpose[10][10];
     int row, col, i, j;
     printf("Enter number of rows and columns: ");
     scanf("%d %d", &row, &col);
+    int matrix[row][col], transpose[col][row];
     printf("Enter elements of the matrix:\n");
     for(i = 0; i < row; i++) {
         for(j = 0; j < col; j++) {
@@ -17,7 +17,7 @@ int main(){
     }
     int is_symmetric=1;
     for(i=0;i<n;i++){
-        for(j=0;j<m;j++){
+        for(j=i+1;j<m;j++){
             if(matrix[i][j]!=matrix[j][i]){
                 is_symmetric=0;
                 break;
@@ -27,4 +27,10 @@ int main(){
             break;
         }
     }
+    if(is_symmetric){
+        printf("Matrix is symmetric.\n");
+    }else{
+        printf("Matrix is not symmetric.\n");
+    }
+    return 0;
 }
\ No newline at end of file
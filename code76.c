@@ -1,9 +1,10 @@
 //Check if the elements on the diagonal of a matrix are distinct.
 #include <stdio.h>
 int main(){
-    int matrix[10][10], n, i, j, k, flag = 0;
-    printf("Enter the order of the square matrix (max 10): ");
+    int n, i, j, flag = 0;
+    printf("Enter the order of the square matrix: ");
     scanf("%d", &n);
+    int matrix[n][n];
     printf("Enter the elements of the matrix:\n");
     for(i = 0; i < n; i++){
         for(j = 0; j < n; j++){
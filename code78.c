@@ -1,9 +1,10 @@
 //Perform diagonal traversal of a matrix.
 #include <stdio.h>
 int main() {
-    int matrix[10][10], rows, cols, i, j, k;
+    int rows, cols, i, j, k;
     printf("Enter number of rows and columns: ");
     scanf("%d %d", &rows, &cols);
+    int matrix[rows][cols];
     printf("Enter matrix elements:\n");
     for(i = 0; i < rows; i++) {
         for(j = 0; j < cols; j++) {
@@ -12,11 +13,12 @@ int main() {
     }
     printf("Diagonal Traversal of the matrix:\n");
     for(k = 0; k <= rows + cols - 2; k++) {
-        for(i = 0; i <= k; i++) {
+        /* Only rows where j = k - i is a valid column. */
+        int first = k - cols + 1 > 0 ? k - cols + 1 : 0;
+        int last = k < rows - 1 ? k : rows - 1;
+        for(i = first; i <= last; i++) {
             j = k - i;
-            if(i < rows && j < cols) {
-                printf("%d ", matrix[i][j]);
-            }
+            printf("%d ", matrix[i][j]);
         }
     }
     return 0;
@@ -1,10 +1,12 @@
 //Multiply two matrices
 #include <stdio.h>
 int main(){
-    int m,n,i,j;
-    printf("Enter number of rows and columns: ");
+    int m,n,p,i,j,k;
+    printf("Enter number of rows and columns of first matrix: ");
     scanf("%d%d",&m,&n);
-    int a[m][n],b[m][n],mul[m][n];
+    printf("Enter number of columns of second matrix: ");
+    scanf("%d",&p);
+    int a[m][n],b[n][p],mul[m][p];
     printf("Enter elements of first matrix:\n");
     for(i=0;i<m;i++){
         for(j=0;j<n;j++){
@@ -12,19 +14,22 @@ int main(){
         }
     }
     printf("Enter elements of second matrix:\n");
-    for(i=0;i<m;i++){
-        for(j=0;j<n;j++){
+    for(i=0;i<n;i++){
+        for(j=0;j<p;j++){
             scanf("%d",&b[i][j]);
         }
     }
     for(i=0;i<m;i++){   
-        for(j=0;j<n;j++){
-            mul[i][j]=a[i][j]*b[i][j];
+        for(j=0;j<p;j++){
+            mul[i][j]=0;
+            for(k=0;k<n;k++){
+                mul[i][j]+=a[i][k]*b[k][j];
+            }
         }
     }
     printf("Resultant Matrix:\n");
     for(i=0;i<m;i++){
-        for(j=0;j<n;j++){
+        for(j=0;j<p;j++){
             printf("%d ",mul[i][j]);
         }
         printf("\n");